@@ -9,10 +9,18 @@ in vec4 VertexColor;
 
 out vec4 FragColor;
 
+// Per-frame data shared by every program (std140, see FrameUniforms in Renderer.h)
+layout (std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    mat4 uOrtho;
+    vec3 fogColor;
+    float fogDensity;
+    vec3 viewPos;
+    float uTime;
+};
+
 uniform bool fogEnabled;
-uniform float fogDensity;
-uniform vec3 fogColor;
-uniform vec3 viewPos;
 
 void main() {
     vec4 color = VertexColor;
@@ -2,6 +2,7 @@
 // ============================================================================
 // basic.vert - OSDSYS Basic Vertex Shader
 // Compatible with Renderer.cpp vertex format: position (3) + color (4)
+// Static meshes are transformed here by uModel and tinted by uTint
 // ============================================================================
 
 layout (location = 0) in vec3 aPos;
@@ -10,11 +11,22 @@ layout (location = 1) in vec4 aColor;
 out vec3 FragPos;
 out vec4 VertexColor;
 
-uniform mat4 uProjection;
-uniform mat4 uView;
+// Per-frame data shared by every program (std140, see FrameUniforms in Renderer.h)
+layout (std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    mat4 uOrtho;
+    vec3 fogColor;
+    float fogDensity;
+    vec3 viewPos;
+    float uTime;
+};
+uniform mat4 uModel;
+uniform vec4 uTint;
 
 void main() {
-    FragPos = aPos;
-    VertexColor = aColor;
-    gl_Position = uProjection * uView * vec4(aPos, 1.0);
+    vec4 worldPos = uModel * vec4(aPos, 1.0);
+    FragPos = worldPos.xyz;
+    VertexColor = aColor * uTint;
+    gl_Position = uProjection * uView * worldPos;
 }
@@ -0,0 +1,35 @@
+#version 330 core
+
+// Bloom: downsample (dual filter, 5 taps) com bright-pass no primeiro nível
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+uniform sampler2D sourceTexture;
+uniform vec2 texelSize;     // 1 / tamanho da textura de origem
+uniform bool brightPass;    // Só no primeiro nível (cena -> meia resolução)
+uniform float threshold;
+uniform float knee;         // Transição suave em torno do threshold
+
+vec3 applyBrightPass(vec3 color) {
+    float brightness = max(color.r, max(color.g, color.b));
+    float soft = clamp(brightness - threshold + knee, 0.0, 2.0 * knee);
+    soft = soft * soft / (4.0 * knee + 0.0001);
+    float contribution = max(soft, brightness - threshold) / max(brightness, 0.0001);
+    return color * contribution;
+}
+
+void main() {
+    vec2 halfTexel = texelSize * 0.5;
+    vec3 sum = texture(sourceTexture, TexCoord).rgb * 4.0;
+    sum += texture(sourceTexture, TexCoord - halfTexel).rgb;
+    sum += texture(sourceTexture, TexCoord + halfTexel).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(halfTexel.x, -halfTexel.y)).rgb;
+    sum += texture(sourceTexture, TexCoord - vec2(halfTexel.x, -halfTexel.y)).rgb;
+
+    vec3 color = sum / 8.0;
+    if (brightPass) {
+        color = applyBrightPass(color);
+    }
+    FragColor = vec4(color, 1.0);
+}
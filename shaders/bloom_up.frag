@@ -0,0 +1,23 @@
+#version 330 core
+
+// Bloom: upsample (dual filter, 8 taps em tenda)
+// Somado ao nível maior com blend aditivo
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+uniform sampler2D sourceTexture;
+uniform vec2 texelSize;     // 1 / tamanho da textura de origem (nível menor)
+
+void main() {
+    vec2 h = texelSize * 0.5;
+    vec3 sum = texture(sourceTexture, TexCoord + vec2(-h.x * 2.0, 0.0)).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(-h.x, h.y)).rgb * 2.0;
+    sum += texture(sourceTexture, TexCoord + vec2(0.0, h.y * 2.0)).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(h.x, h.y)).rgb * 2.0;
+    sum += texture(sourceTexture, TexCoord + vec2(h.x * 2.0, 0.0)).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(h.x, -h.y)).rgb * 2.0;
+    sum += texture(sourceTexture, TexCoord + vec2(0.0, -h.y * 2.0)).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(-h.x, -h.y)).rgb * 2.0;
+    FragColor = vec4(sum / 12.0, 1.0);
+}
@@ -0,0 +1,109 @@
+#version 330 core
+// ============================================================================
+// gs_sprite.frag - OSDSYS Sprite com textura GS crua
+// Os dados ficam na VRAM no formato original do GS (swizzled, 4/8/16/32 bpp);
+// o endereço page/block/column é calculado aqui, igual a
+// TextureLoader::GetGSAddress, e os índices passam pela CLUT no mesmo passo
+// ============================================================================
+
+in vec2 TexCoord;
+in vec4 VertexColor;
+
+out vec4 FragColor;
+
+uniform usampler2D uGsData;     // Payload: R32UI (PSM32), R16UI (PSM16), R8UI (resto)
+uniform sampler2D uClut;        // 256x1 RGBA8
+uniform bool uHasClut;          // false = indexadas são máscara de alpha (OSD)
+uniform int uPsm;               // PS2_PSM (TextureLoader.h)
+uniform ivec2 uSize;
+
+const int DATA_WIDTH = 256;     // Texels por linha do payload (GsTexture::DATA_WIDTH)
+
+const int PSM_32  = 0;
+const int PSM_24  = 1;
+const int PSM_16  = 2;
+const int PSM_16S = 3;
+const int PSM_8   = 4;
+const int PSM_8H  = 5;
+const int PSM_4   = 6;
+
+// Tabelas de blocos do GS (block8 == block32, block4 == block16)
+const int block32[32] = int[](
+    0, 1, 4, 5, 16, 17, 20, 21, 2, 3, 6, 7, 18, 19, 22, 23,
+    8, 9, 12, 13, 24, 25, 28, 29, 10, 11, 14, 15, 26, 27, 30, 31
+);
+const int block16[32] = int[](
+    0, 2, 8, 10, 1, 3, 9, 11, 4, 6, 12, 14, 5, 7, 13, 15,
+    16, 18, 24, 26, 17, 19, 25, 27, 20, 22, 28, 30, 21, 23, 29, 31
+);
+
+uint Fetch(int index) {
+    return texelFetch(uGsData, ivec2(index % DATA_WIDTH, index / DATA_WIDTH), 0).r;
+}
+
+// Índice -> cor; sem CLUT vira máscara branca (alpha já convertido)
+vec4 Indexed(uint index, float maskAlpha) {
+    if (uHasClut) {
+        return texelFetch(uClut, ivec2(int(index), 0), 0);
+    }
+    return vec4(1.0, 1.0, 1.0, maskAlpha);
+}
+
+vec4 Decode(int x, int y) {
+    int w = uSize.x;
+
+    if (uPsm == PSM_32) {
+        // Page 64x32, block 8x8 (índice em texels de 4 bytes)
+        int page = (x >> 6) + (y >> 5) * ((w + 63) >> 6);
+        int ox = x & 63, oy = y & 31;
+        int block = block32[(oy >> 3) * 8 + (ox >> 3)];
+        uint v = Fetch(page * 2048 + block * 64 + (oy & 7) * 8 + (ox & 7));
+
+        vec3 rgb = vec3(uvec3(v, v >> 8u, v >> 16u) & 0xFFu) / 255.0;
+        float a = min(float(v >> 24u) * 2.0, 255.0) / 255.0;   // Alpha PS2 0..128
+        return vec4(rgb, a);
+    }
+
+    if (uPsm == PSM_24) {
+        // RGB24 linear (mesma leitura do Read32 na CPU)
+        int addr = (y * w + x) * 3;
+        return vec4(float(Fetch(addr)), float(Fetch(addr + 1)), float(Fetch(addr + 2)), 255.0) / 255.0;
+    }
+
+    if (uPsm == PSM_16 || uPsm == PSM_16S) {
+        // Page 64x64, block 16x8 (índice em texels de 2 bytes)
+        int page = (x >> 6) + (y >> 6) * ((w + 63) >> 6);
+        int ox = x & 63, oy = y & 63;
+        int block = block16[(oy >> 3) * 4 + (ox >> 4)];
+        uint raw = Fetch(page * 4096 + block * 128 + (oy & 7) * 16 + (ox & 15));
+
+        // A1 B5 G5 R5, expandido como no Read16
+        uvec3 c = (uvec3(raw, raw >> 5u, raw >> 10u) & 0x1Fu) << 3u;
+        c |= c >> 5u;
+        bool visible = (raw >> 15u) != 0u || any(notEqual(c, uvec3(0u)));
+        return vec4(vec3(c) / 255.0, visible ? 1.0 : 0.0);
+    }
+
+    if (uPsm == PSM_8 || uPsm == PSM_8H) {
+        // Page 128x64, block 16x16
+        int page = (x >> 7) + (y >> 6) * ((w + 127) >> 7);
+        int ox = x & 127, oy = y & 63;
+        int block = block32[(oy >> 4) * 8 + (ox >> 4)];
+        uint val = Fetch(page * 8192 + block * 256 + (oy & 15) * 16 + (ox & 15));
+        return Indexed(val, val > 128u ? 1.0 : float(val * 2u) / 255.0);
+    }
+
+    if (uPsm >= PSM_4) {
+        // 4bpp linear, nibble baixo primeiro (mesmo fallback do Read4)
+        int pixel = y * w + x;
+        uint v = (Fetch(pixel >> 1) >> uint((pixel & 1) * 4)) & 0xFu;
+        return Indexed(v, float(v * 17u) / 255.0);
+    }
+
+    return vec4(1.0, 0.0, 1.0, 1.0);    // Formato desconhecido
+}
+
+void main() {
+    ivec2 p = clamp(ivec2(TexCoord * vec2(uSize)), ivec2(0), uSize - 1);
+    FragColor = Decode(p.x, p.y) * VertexColor;
+}
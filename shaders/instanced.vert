@@ -0,0 +1,33 @@
+#version 330 core
+// ============================================================================
+// instanced.vert - OSDSYS Instanced Primitive Vertex Shader
+// Unit geometry: position (3) + color (4)
+// Per instance: model matrix (4 x vec4) + color (4), divisor 1
+// Pairs with basic.frag (same outputs as basic.vert)
+// ============================================================================
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec4 aColor;
+layout (location = 2) in mat4 aModel;          // locations 2..5
+layout (location = 6) in vec4 aInstanceColor;
+
+out vec3 FragPos;
+out vec4 VertexColor;
+
+// Per-frame data shared by every program (std140, see FrameUniforms in Renderer.h)
+layout (std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    mat4 uOrtho;
+    vec3 fogColor;
+    float fogDensity;
+    vec3 viewPos;
+    float uTime;
+};
+
+void main() {
+    vec4 worldPos = aModel * vec4(aPos, 1.0);
+    FragPos = worldPos.xyz;
+    VertexColor = aColor * aInstanceColor;
+    gl_Position = uProjection * uView * worldPos;
+}
@@ -1,22 +1,21 @@
 #version 330 core
 
 // Post-processing shader
-// Fog + Bloom + Dithering (efeitos do PS2)
+// Bloom (composição) + Dithering (efeitos do PS2) + upscale da resolução interna
+// (o fog é aplicado por fragmento no basic.frag)
 
 in vec2 TexCoord;
 out vec4 FragColor;
 
-uniform sampler2D screenTexture;
-uniform float time;
-
-// Fog settings
-uniform bool fogEnabled;
-uniform float fogDensity;
-uniform vec3 fogColor;
+uniform sampler2D screenTexture;    // Cena na resolução interna (GL_LINEAR)
+uniform vec2 sourceSize;            // Resolução interna em pixels
+uniform vec2 outputSize;            // Viewport de saída em pixels
+uniform bool sharpFilter;           // Sharp-bilinear (true) ou nearest (false)
 
 // Bloom settings
 uniform bool bloomEnabled;
 uniform float bloomIntensity;
+uniform sampler2D bloomTexture;     // Nível 0 da cadeia de bloom (meia resolução)
 
 // Dithering matrix 4x4 (PS2 style)
 const float dither[16] = float[](
@@ -32,28 +31,32 @@ float getDither(vec2 coord) {
     return dither[y * 4 + x] / 16.0;
 }
 
+// Nearest: centro do texel. Sharp-bilinear: pixels inteiros nítidos, só a
+// borda entre texels é interpolada (evita o shimmer de escalas não inteiras)
+vec2 upscaleCoord(vec2 uv) {
+    vec2 texel = uv * sourceSize;
+    vec2 texelFloor = floor(texel);
+    if (!sharpFilter) {
+        return (texelFloor + 0.5) / sourceSize;
+    }
+
+    vec2 scale = max(floor(outputSize / sourceSize), vec2(1.0));
+    vec2 region = 0.5 - 0.5 / scale;
+    vec2 centerDist = fract(texel) - 0.5;
+    vec2 f = (centerDist - clamp(centerDist, -region, region)) * scale + 0.5;
+    return (texelFloor + f) / sourceSize;
+}
+
 void main() {
-    vec4 color = texture(screenTexture, TexCoord);
+    vec4 color = texture(screenTexture, upscaleCoord(TexCoord));
     
-    // Bloom (simple gaussian-like)
+    // Bloom (cadeia de downsample/upsample, ver bloom_down/bloom_up)
     if (bloomEnabled) {
-        vec2 texelSize = 1.0 / textureSize(screenTexture, 0);
-        vec4 bloom = vec4(0.0);
-        
-        // 3x3 kernel
-        for (int x = -1; x <= 1; x++) {
-            for (int y = -1; y <= 1; y++) {
-                vec2 offset = vec2(float(x), float(y)) * texelSize;
-                bloom += texture(screenTexture, TexCoord + offset);
-            }
-        }
-        
-        bloom /= 9.0;
-        color = mix(color, bloom, bloomIntensity * 0.3);
+        color.rgb += texture(bloomTexture, TexCoord).rgb * bloomIntensity;
     }
     
-    // Dithering (PS2 style - opcional)
-    float ditherValue = getDither(gl_FragCoord.xy);
+    // Dithering (PS2 style - na grade de pixels interna, escala junto com a imagem)
+    float ditherValue = getDither(floor(TexCoord * sourceSize));
     color.rgb += (ditherValue - 0.5) * 0.02; // Subtle dithering
     
     // Clamp
@@ -1,15 +1,15 @@
 #version 330 core
 // ============================================================================
 // text.frag - OSDSYS Text Rendering Fragment Shader
-// Samples font atlas texture with tint color
+// Samples the glyph array (one layer per font bank) with tint color
 // ============================================================================
 
-in vec2 TexCoord;
+in vec3 TexCoord;
 in vec4 VertexColor;
 
 out vec4 FragColor;
 
-uniform sampler2D uFontAtlas;
+uniform sampler2DArray uFontAtlas;   // R8, alpha via swizzle
 
 void main() {
     vec4 texColor = texture(uFontAtlas, TexCoord);
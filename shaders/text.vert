@@ -5,16 +5,25 @@
 // ============================================================================
 
 layout (location = 0) in vec2 aPos;
-layout (location = 1) in vec2 aTexCoord;
+layout (location = 1) in vec3 aTexCoord;     // uv + glyph bank layer
 layout (location = 2) in vec4 aColor;
 
-out vec2 TexCoord;
+out vec3 TexCoord;
 out vec4 VertexColor;
 
-uniform mat4 uProjection;
+// Per-frame data shared by every program (std140, see FrameUniforms in Renderer.h)
+layout (std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    mat4 uOrtho;
+    vec3 fogColor;
+    float fogDensity;
+    vec3 viewPos;
+    float uTime;
+};
 
 void main() {
     TexCoord = aTexCoord;
     VertexColor = aColor;
-    gl_Position = uProjection * vec4(aPos, 0.0, 1.0);
+    gl_Position = uOrtho * vec4(aPos, 0.0, 1.0);
 }
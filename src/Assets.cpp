@@ -84,6 +84,12 @@ bool AssetLoader::LoadICOBFromPath(const std::string& path, ICOBModel& outModel)
     for (uint32_t idx : icobIndices) {
         outModel.indices.push_back(static_cast<uint16_t>(idx));
     }
+
+    // Bounding sphere for the renderer's frustum/fog culling
+    if (!outModel.vertices.empty()) {
+        Math::BoundingSphere(&outModel.vertices[0].position, outModel.vertices.size(), sizeof(OSDVertex),
+                             outModel.boundsCenter, outModel.boundsRadius);
+    }
     
     printf("[AssetLoader] Converted to ICOBModel: %zu vertices, %zu indices\n",
            outModel.vertices.size(), outModel.indices.size());
@@ -33,6 +33,8 @@ struct ICOBModel {
     ICOBHeader header;
     std::vector<OSDVertex> vertices;
     std::vector<uint16_t> indices;
+    Vec3 boundsCenter;          // Model-space bounding sphere (culling)
+    float boundsRadius = 0.0f;  // 0 = unknown, never culled
     
     bool IsValid() const { return !vertices.empty(); }
 };
@@ -0,0 +1,89 @@
+#include "Platform.h"
+#include "CommandList.h"
+#include <algorithm>
+
+// ============================================================================
+// Key Helpers
+// ============================================================================
+static constexpr uint64_t PASS_MAX = 0xFFF;
+static constexpr uint64_t SEQUENCE_MAX = 0xFFFFF;
+static constexpr uint64_t DEPTH_MAX = 0xFFFFFF;
+
+// View distance in 1/16 units, saturating at 24 bits (~1M units)
+static uint64_t QuantizeDepth(float depth) {
+    if (!(depth > 0.0f)) return 0;
+    float q = depth * 16.0f;
+    return q >= (float)DEPTH_MAX ? DEPTH_MAX : (uint64_t)q;
+}
+
+// ============================================================================
+// CommandList Implementation
+// ============================================================================
+void CommandList::Reset() {
+    packets.clear();
+    states.clear();
+    arena.clear();
+    time = 0.0f;
+    profileScope = nullptr;
+    pass = 0;
+    sequence = 0;
+    last3D = false;
+    hasPackets = false;
+}
+
+void CommandList::Sort() {
+    // Stable: sequence saturates past SEQUENCE_MAX packets, after which equal
+    // keys must keep their recording order
+    std::stable_sort(packets.begin(), packets.end(), [](const DrawPacket& a, const DrawPacket& b) {
+        return a.key < b.key;
+    });
+}
+
+void CommandList::PushState(const StateBlock& block) {
+    states.push_back(block);
+}
+
+uint32_t CommandList::PushData(const void* data, size_t bytes) {
+    size_t offset = (arena.size() + 7) & ~(size_t)7;
+    arena.resize(offset + bytes);
+    memcpy(arena.data() + offset, data, bytes);
+    return (uint32_t)offset;
+}
+
+void CommandList::AppendData(const void* data, size_t bytes) {
+    size_t offset = arena.size();
+    arena.resize(offset + bytes);
+    memcpy(arena.data() + offset, data, bytes);
+}
+
+void CommandList::Add3D(DrawOp op, Bucket bucket, float depth, uint32_t dataOffset) {
+    uint64_t bits = (uint64_t)bucket << 50;
+    if (bucket == BUCKET_OPAQUE) {
+        // Group by op (shader/mesh family), then front-to-back for early Z
+        bits |= ((uint64_t)op & 0x3F) << 44;
+        bits |= QuantizeDepth(depth) << 20;
+    } else if (bucket == BUCKET_TRANSLUCENT) {
+        bits |= (DEPTH_MAX - QuantizeDepth(depth)) << 26;
+    }
+    Add(op, true, bits, dataOffset);
+}
+
+void CommandList::Add2D(DrawOp op, uint32_t dataOffset) {
+    Add(op, false, (uint64_t)BUCKET_ORDERED << 50, dataOffset);
+}
+
+void CommandList::Add(DrawOp op, bool is3D, uint64_t bucketBits, uint32_t dataOffset) {
+    if (hasPackets && is3D != last3D && pass < PASS_MAX) {
+        pass++;
+    }
+    last3D = is3D;
+    hasPackets = true;
+
+    DrawPacket packet;
+    packet.key = ((uint64_t)pass << 52) | bucketBits | std::min<uint64_t>(sequence, SEQUENCE_MAX);
+    packet.dataOffset = dataOffset;
+    packet.stateIndex = states.empty() ? 0 : (uint32_t)(states.size() - 1);
+    packet.op = op;
+    packets.push_back(packet);
+    sequence++;
+}
@@ -0,0 +1,117 @@
+#pragma once
+// ============================================================================
+// CommandList.h - Recorded frame of draw packets
+//
+// While recording, Renderer draw calls append compact POD packets here
+// instead of touching GL. The list is sorted by a 64-bit key and replayed
+// by Renderer::Execute, either inline or on the render thread.
+// ============================================================================
+
+#include "MathTypes.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// ============================================================================
+// DrawOp - Packet type (arguments live in the list's arena)
+// ============================================================================
+enum class DrawOp : uint8_t {
+    Cube,
+    Sphere,
+    GpuMesh,            // ICOBModel draws are recorded as their uploaded GpuMesh
+    CubesInstanced,
+    SpheresInstanced,
+    Line,
+    Rect,
+    Sprite,
+    GsSprite,
+    Text
+};
+
+// ============================================================================
+// StateBlock - Renderer state captured at record time
+// Packets reference blocks by index, so a run of draws shares one block
+// ============================================================================
+struct StateBlock {
+    float projection[16];
+    float view[16];
+    Vec3 cameraPosition;
+    Vec3 fogColor;
+    float fogDensity;
+    float fogCullThreshold;     // 0 = fog culling off
+    bool fogEnabled;
+    bool additive;
+    bool depthTest;
+    bool wireframe;
+};
+
+// ============================================================================
+// DrawPacket - One recorded draw
+// ============================================================================
+struct DrawPacket {
+    uint64_t key;
+    uint32_t dataOffset;    // Byte offset of the arguments in the arena
+    uint32_t stateIndex;
+    DrawOp op;
+};
+
+// ============================================================================
+// CommandList
+//
+// Sort key layout (most significant bits first):
+//   [63:52] pass    - bumped whenever recording switches between 3D and 2D,
+//                     so 2D backgrounds/overlays keep their place around 3D
+//   [51:50] bucket  - 0 opaque 3D, 1 translucent 3D, 2 ordered
+//   opaque:      [49:44] op, [43:20] depth (front-to-back), [19:0] sequence
+//                (op picks the program; opaque 3D draws are untextured, so
+//                there are no separate shader/texture fields)
+//   translucent: [49:26] far-to-near depth (back-to-front), [19:0] sequence
+//   ordered:     [19:0] sequence (2D and 3D drawn with depth test off)
+// Sequence saturates at 0xFFFFF; Sort() is stable, so order still holds past it
+// ============================================================================
+class CommandList {
+public:
+    enum Bucket : uint32_t {
+        BUCKET_OPAQUE = 0,
+        BUCKET_TRANSLUCENT = 1,
+        BUCKET_ORDERED = 2
+    };
+
+    std::vector<DrawPacket> packets;
+    std::vector<StateBlock> states;
+    std::vector<uint8_t> arena;
+    float time = 0.0f;
+    const char* profileScope = nullptr;     // Static string (scene name)
+    uint64_t frame = 0;                     // Renderer frame number, stamped by BeginRecording
+
+    void Reset();
+    void Sort();
+
+    // Start a new state block; later packets reference it
+    void PushState(const StateBlock& block);
+
+    // Copy op arguments into the arena (8-byte aligned), returns the offset
+    uint32_t PushData(const void* data, size_t bytes);
+    // Reserve space after the last PushData (variable-length tails: text, instances)
+    void AppendData(const void* data, size_t bytes);
+
+    template <typename T>
+    const T& Data(uint32_t offset) const {
+        return *reinterpret_cast<const T*>(arena.data() + offset);
+    }
+    const uint8_t* Tail(uint32_t offset, size_t headerBytes) const {
+        return arena.data() + offset + headerBytes;
+    }
+
+    // depth = view distance, ignored for BUCKET_ORDERED
+    void Add3D(DrawOp op, Bucket bucket, float depth, uint32_t dataOffset);
+    void Add2D(DrawOp op, uint32_t dataOffset);
+
+private:
+    uint32_t pass = 0;
+    uint32_t sequence = 0;
+    bool last3D = false;
+    bool hasPackets = false;
+
+    void Add(DrawOp op, bool is3D, uint64_t bucketBits, uint32_t dataOffset);
+};
@@ -10,6 +10,36 @@
 #include "scenes/DebugSoundScene.h"
 #include "scenes/DebugTextureScene.h"
 
+// ============================================================================
+// State Names
+// ============================================================================
+const char* GetStateName(State state) {
+    switch (state) {
+        case State::SCELogo:       return "SCELogo";
+        case State::Boot:          return "Boot";
+        case State::Menu:          return "Menu";
+        case State::Config:        return "Config";
+        case State::Browser:       return "Browser";
+        case State::Version:       return "Version";
+        case State::DVD:           return "DVD";
+        case State::DebugVu1Scene: return "DebugVu1";
+        case State::DebugFont:     return "DebugFont";
+        case State::DebugSound:    return "DebugSound";
+        case State::DebugTexture:  return "DebugTexture";
+    }
+    return "Unknown";
+}
+
+bool ParseStateName(const char* name, State& state) {
+    for (int i = (int)State::SCELogo; i <= (int)State::DebugTexture; i++) {
+        if (SDL_strcasecmp(name, GetStateName((State)i)) == 0) {
+            state = (State)i;
+            return true;
+        }
+    }
+    return false;
+}
+
 // ============================================================================
 // FixedTimeStep Implementation
 // ============================================================================
@@ -28,13 +58,22 @@ void FixedTimeStep::Update() {
 }
 
 bool FixedTimeStep::ShouldUpdate() {
-    if (accumulator >= FIXED_DT) {
-        accumulator -= FIXED_DT;
+    if (accumulator >= fixedDt) {
+        accumulator -= fixedDt;
         return true;
     }
     return false;
 }
 
+void FixedTimeStep::SetTickRate(double hz) {
+    if (hz <= 0.0) return;
+    // Keep the same fraction of a tick pending, so alpha doesn't jump
+    double fraction = accumulator / fixedDt;
+    fixedDt = 1.0 / hz;
+    accumulator = fraction * fixedDt;
+    printf("[FixedTimeStep] Tick rate %.2f Hz (%.3f ms)\n", hz, fixedDt * 1000.0);
+}
+
 // ============================================================================
 // ProcessTransition Implementation (sub_203970)
 // State machine matching original OSDSYS behavior
@@ -118,20 +157,33 @@ void MainLoopController::UpdateLoop() {
 
     // Fixed timestep update (matches loop at 0x0020A980)
     while (timeStep.ShouldUpdate()) {
-        // Process state transitions (0x0020A984 - state change check)
-        if (stateMachine.HasPendingTransition()) {
-            stateMachine.ProcessStateChange();
-            LoadSceneForState(stateMachine.GetCurrentState());
-        }
+        Tick();
+    }
+    renderAlpha = timeStep.GetAlpha();
+}
 
-        // Update current scene
-        if (currentScene) {
-            currentScene->Update(FixedTimeStep::GetDeltaTime());
-            
-            // Check if scene requested a state transition
-            if (currentScene->requestedNextState != -1) {
-                State requestedState = (State)currentScene->requestedNextState;
-                currentScene->requestedNextState = -1; // Reset
+void MainLoopController::StepFixed() {
+    Tick();
+    renderAlpha = 1.0f;     // Render exactly the state just simulated
+}
+
+void MainLoopController::Tick() {
+    // Process state transitions (0x0020A984 - state change check)
+    if (stateMachine.HasPendingTransition()) {
+        stateMachine.ProcessStateChange();
+        LoadSceneForState(stateMachine.GetCurrentState());
+    }
+
+    // Update current scene
+    if (currentScene) {
+        currentScene->prevTime = currentScene->time;
+        currentScene->Update(timeStep.GetDeltaTime());
+        
+        // Check if scene requested a state transition
+        if (currentScene->requestedNextState != -1) {
+            State requestedState = (State)currentScene->requestedNextState;
+            currentScene->requestedNextState = -1; // Reset
+            if (!sceneLocked) {
                 RequestStateChange(requestedState);
             }
         }
@@ -139,7 +191,13 @@ void MainLoopController::UpdateLoop() {
 }
 
 void MainLoopController::RenderFrame(Renderer& renderer) {
+    // A new scene was loaded: textures pinned by the previous one become evictable
+    if (loadedState != pinnedState) {
+        renderer.ReleaseSceneTextures();
+        pinnedState = loadedState;
+    }
     if (currentScene) {
+        currentScene->renderAlpha = renderAlpha;
         currentScene->Render(renderer);
     }
 }
@@ -204,7 +262,9 @@ void MainLoopController::LoadSceneForState(State state) {
     }
 
     // Enter new scene
+    loadedState = state;
     if (currentScene) {
         currentScene->OnEnter();
+        currentScene->prevTime = currentScene->time;
     }
 }
@@ -24,21 +24,35 @@ enum class State {
     DebugTexture = 9  // Debug texture rendering test
 };
 
+// Human-readable state name (static string, used for profiling/stats keys)
+const char* GetStateName(State state);
+bool ParseStateName(const char* name, State& state);  // Case-insensitive
+
 // ============================================================================
-// FixedTimeStep - 60 Hz timing (as in original OSDSYS main loop)
-// Based on sub_209EB8 loop structure
+// FixedTimeStep - Fixed tick timing (as in original OSDSYS main loop)
+// Based on sub_209EB8 loop structure. 60 Hz by default; the PS2 ran its
+// loop on the video field rate, 59.94 Hz (NTSC) or 50 Hz (PAL)
 // ============================================================================
 class FixedTimeStep {
 public:
-    static constexpr double FIXED_DT = 1.0 / 60.0; // 16.67ms per frame
+    static constexpr double RATE_60 = 60.0;
+    static constexpr double RATE_NTSC = 60000.0 / 1001.0;  // 59.94 Hz
+    static constexpr double RATE_PAL = 50.0;
 
     void Update();
     bool ShouldUpdate();
+    void SetTickRate(double hz);
+    double GetTickRate() const { return 1.0 / fixedDt; }
     double GetTime() const { return totalTime; }
-    static double GetDeltaTime() { return FIXED_DT; }
+    double GetDeltaTime() const { return fixedDt; }
+
+    // Fraction of a tick left in the accumulator: how far the display time is
+    // past the last simulated state (0..1), used to interpolate rendering
+    float GetAlpha() const { return (float)(accumulator / fixedDt); }
 
 private:
     uint64_t lastTime = 0;
+    double fixedDt = 1.0 / RATE_60;
     double accumulator = 0.0;
     double totalTime = 0.0;
 };
@@ -71,13 +85,25 @@ public:
 
     void HandleInput(const SDL_Event& event);
     void UpdateLoop();
+    void StepFixed();       // Exactly one fixed tick, ignoring wall time (headless runs)
     void RenderFrame(Renderer& renderer);
+    void SetTickRate(double hz) { timeStep.SetTickRate(hz); }
+    double GetTickRate() const { return timeStep.GetTickRate(); }
+    double GetTickDelta() const { return timeStep.GetDeltaTime(); }
     void RequestStateChange(State newState);
+    const char* GetCurrentSceneName() const { return GetStateName(loadedState); }
+    // Ignore transitions requested by the scene itself (benchmarks pin one scene)
+    void SetSceneLock(bool locked) { sceneLocked = locked; }
 
 private:
     FixedTimeStep timeStep;
     ProcessTransition stateMachine;
     std::unique_ptr<Scene> currentScene;
+    State loadedState = State::Boot;    // State of the scene actually loaded
+    State pinnedState = State::Boot;    // Scene whose texture pins the renderer holds
+    float renderAlpha = 1.0f;           // Interpolation factor for the next RenderFrame
+    bool sceneLocked = false;
 
+    void Tick();
     void LoadSceneForState(State state);
 };
@@ -1,4 +1,5 @@
 #include "FontLoader.h"
+#include "TextCodec.h"
 #include <fstream>
 #include <iostream>
 #include <algorithm>
@@ -60,6 +61,89 @@ float FontLoader::GetTextWidth(const char* text, float scale) const {
     return width;
 }
 
+// ============================================================================
+// TABELA UNIFICADA DE GLIFOS
+// ============================================================================
+
+bool FontLoader::BuildGlyphTable(GlyphTable& table) const {
+    table = GlyphTable();
+
+    // Camadas com o tamanho do maior banco; UVs reescaladas para ela
+    std::vector<const FontBank*> layerBanks;
+    for (const auto& bank : banks) {
+        if (!bank.isValid || bank.config.type == FontType::VECTOR_DATA) continue;
+        table.layerWidth = std::max(table.layerWidth, bank.config.width);
+        table.layerHeight = std::max(table.layerHeight, bank.config.height);
+        layerBanks.push_back(&bank);
+    }
+    if (layerBanks.empty()) return false;
+
+    table.layers = (int)layerBanks.size();
+    table.pixels.assign((size_t)table.layers * table.layerWidth * table.layerHeight, 0);
+    table.glyphs.push_back({0, 0, 0, 0, 0, 0, 8});      // Fallback até achar o '?'
+    table.lookup.assign(0x10000, 0);
+
+    for (int layer = 0; layer < table.layers; layer++) {
+        const FontBank& bank = *layerBanks[layer];
+        const AtlasConfig& cfg = bank.config;
+
+        // Só o alpha interessa (os bancos são brancos)
+        uint8_t* dst = table.pixels.data() + (size_t)layer * table.layerWidth * table.layerHeight;
+        for (int y = 0; y < cfg.height; y++) {
+            for (int x = 0; x < cfg.width; x++) {
+                size_t src = ((size_t)y * cfg.width + x) * 4 + 3;
+                if (src < bank.textureData.size()) {
+                    dst[(size_t)y * table.layerWidth + x] = bank.textureData[src];
+                }
+            }
+        }
+
+        float scaleU = cfg.width / (float)table.layerWidth;
+        float scaleV = cfg.height / (float)table.layerHeight;
+
+        auto AddGlyph = [&](uint32_t codepoint, const FontGlyph& g) {
+            if (codepoint >= table.lookup.size() || table.lookup[codepoint] != 0) return;
+            TableGlyph glyph;
+            glyph.u0 = g.u0 * scaleU;
+            glyph.u1 = g.u1 * scaleU;
+            glyph.v0 = g.v0 * scaleV;
+            glyph.v1 = g.v1 * scaleV;
+            glyph.layer = (float)layer;
+            // Células sem UV (espaço, fora do atlas) só avançam o cursor
+            glyph.width = (g.u1 > g.u0) ? (float)g.width : 0.0f;
+            glyph.advance = (float)g.advance;
+            table.lookup[codepoint] = (uint16_t)table.glyphs.size();
+            table.glyphs.push_back(glyph);
+        };
+
+        if (cfg.type == FontType::ASCII_LEGACY) {
+            for (int c = 0x20; c < 0x80 && c < (int)bank.glyphs.size(); c++) {
+                AddGlyph((uint32_t)c, bank.glyphs[c]);
+            }
+        } else if (cfg.type == FontType::KANJI_GRID) {
+            // 94 células por linha JIS; FNTEX000 = ku 1-8, FNTEX001 = ku 16-23
+            int firstKu = (cfg.name == "FNTEX001.bin") ? 16 : 1;
+            for (size_t i = 0; i < bank.glyphs.size(); i++) {
+                uint32_t cp = TextCodec::KutenToUnicode(firstKu + (int)(i / 94), (int)(i % 94) + 1);
+                if (cp) AddGlyph(cp, bank.glyphs[i]);
+            }
+        } else if (cfg.type == FontType::OSD_ICONS) {
+            uint32_t base = (cfg.name == "FNTADD00.bin") ? GlyphTable::OSD_EXTRA_BASE : GlyphTable::OSD_ICON_BASE;
+            for (size_t i = 0; i < bank.glyphs.size(); i++) {
+                AddGlyph(base + (uint32_t)i, bank.glyphs[i]);
+            }
+        }
+    }
+
+    if (table.lookup['?'] != 0) {
+        table.glyphs[0] = table.glyphs[table.lookup['?']];
+    }
+
+    printf("[FontLoader] Glyph table: %zu glyphs in %d layers (%dx%d)\n",
+           table.glyphs.size() - 1, table.layers, table.layerWidth, table.layerHeight);
+    return true;
+}
+
 // Implementação do Getter que faltava na compilação anterior
 const FontBank* FontLoader::GetBank(size_t index) const {
     if (index < banks.size()) {
@@ -33,6 +33,37 @@ struct FontGlyph {
     int width, height, advance;
 };
 
+// Glifo da tabela unificada (UVs relativas à camada, que tem o tamanho do maior banco)
+struct TableGlyph {
+    float u0, v0, u1, v1;
+    float layer;
+    float width, advance;
+};
+
+// Todos os bancos bitmap numa textura só (GL_TEXTURE_2D_ARRAY, uma camada por banco)
+// e um índice direto codepoint -> glifo, para o texto sair numa draw call.
+// Faixas Unicode:
+//   ASCII 0x20-0x7F         FNTASCII
+//   JIS X 0208 ku 1-8       FNTEX000 (símbolos, kana, grego, cirílico)
+//   JIS X 0208 ku 16-23     FNTEX001 (início dos kanji nível 1)
+//   U+E000 + célula         FNTEXOSD (ícones do OSD, Private Use Area)
+//   U+E100 + célula         FNTADD00
+struct GlyphTable {
+    static constexpr uint32_t OSD_ICON_BASE = 0xE000;
+    static constexpr uint32_t OSD_EXTRA_BASE = 0xE100;
+
+    int layerWidth = 0;
+    int layerHeight = 0;
+    int layers = 0;
+    std::vector<uint8_t> pixels;        // R8 (alpha), layers * layerWidth * layerHeight
+    std::vector<TableGlyph> glyphs;     // [0] = glifo de fallback ('?')
+    std::vector<uint16_t> lookup;       // Plano básico (BMP): codepoint -> índice em glyphs
+
+    const TableGlyph& Find(uint32_t codepoint) const {
+        return codepoint < lookup.size() ? glyphs[lookup[codepoint]] : glyphs[0];
+    }
+};
+
 // Um Arquivo carregado
 struct FontBank {
     AtlasConfig config;
@@ -64,6 +95,9 @@ public:
     const FontGlyph& GetGlyph(int index) const;
     float GetTextWidth(const char* text, float scale) const;
 
+    // Monta a tabela unificada com todos os bancos bitmap carregados
+    bool BuildGlyphTable(GlyphTable& table) const;
+
 private:
     std::vector<FontBank> banks; 
     int mainBankIndex;
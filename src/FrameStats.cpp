@@ -0,0 +1,173 @@
+#include "Platform.h"
+#include "FrameStats.h"
+#include <cmath>
+
+// ============================================================================
+// Histogram Implementation
+// ============================================================================
+int FrameStats::Histogram::BucketFor(uint32_t us) {
+    if (us < (uint32_t)LINEAR_LIMIT) return (int)us;
+
+    int msb = 31;
+    while (!(us & (1u << msb))) msb--;
+    if (msb >= MAX_BITS) return BUCKETS - 1;
+
+    // Top SUB_BITS bits below the leading one pick the step inside the octave
+    int sub = (int)((us >> (msb - SUB_BITS)) & ((1u << SUB_BITS) - 1));
+    return LINEAR_LIMIT + (msb - SUB_BITS - 1) * (1 << SUB_BITS) + sub;
+}
+
+double FrameStats::Histogram::GetBucketUpperMs(int bucket) {
+    if (bucket < LINEAR_LIMIT) return (bucket + 1) / 1000.0;
+
+    int octave = (bucket - LINEAR_LIMIT) >> SUB_BITS;
+    int sub = (bucket - LINEAR_LIMIT) & ((1 << SUB_BITS) - 1);
+    int msb = octave + SUB_BITS + 1;
+    double step = (double)(1u << (msb - SUB_BITS));
+    return ((double)(1u << msb) + (sub + 1) * step) / 1000.0;
+}
+
+void FrameStats::Histogram::Add(double ms) {
+    if (!(ms >= 0.0)) ms = 0.0;
+    double us = ms * 1000.0;
+    uint32_t value = us >= 4.0e9 ? 0xFFFFFFFFu : (uint32_t)us;
+
+    buckets[BucketFor(value)]++;
+    count++;
+    sumUs += us;
+    if (value > maxUs) maxUs = value;
+}
+
+double FrameStats::Histogram::GetPercentileMs(double percentile) const {
+    if (count == 0) return 0.0;
+
+    uint64_t rank = (uint64_t)ceil(percentile / 100.0 * count);
+    if (rank < 1) rank = 1;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            // The top bucket's bound can exceed the real maximum
+            double upper = GetBucketUpperMs(i);
+            return upper < GetMaxMs() ? upper : GetMaxMs();
+        }
+    }
+    return GetMaxMs();
+}
+
+// ============================================================================
+// FrameStats Implementation
+// ============================================================================
+const char* FrameStats::GetMetricName(Metric metric) {
+    switch (metric) {
+        case METRIC_UPDATE: return "update";
+        case METRIC_RENDER: return "render";
+        case METRIC_SWAP:   return "swap";
+        case METRIC_FRAME:  return "frame";
+        default:            return "unknown";
+    }
+}
+
+void FrameStats::AddFrame(const char* scene, double updateMs, double renderMs, double swapMs, double frameMs) {
+    SceneStats& stats = scenes[scene];
+    stats.metrics[METRIC_UPDATE].Add(updateMs);
+    stats.metrics[METRIC_RENDER].Add(renderMs);
+    stats.metrics[METRIC_SWAP].Add(swapMs);
+    stats.metrics[METRIC_FRAME].Add(frameMs);
+
+    // One and a half periods: the frame made it to the display a vblank late
+    if (frameMs > deadlineMs * 1.5) {
+        stats.missedDeadlines++;
+    }
+}
+
+void FrameStats::Reset() {
+    scenes.clear();
+}
+
+void FrameStats::PrintSummary() const {
+    printf("[FrameStats] Deadline %.2f ms\n", deadlineMs);
+    for (const auto& pair : scenes) {
+        const SceneStats& stats = pair.second;
+        printf("[FrameStats] %s: %llu frames, %llu missed deadlines\n", pair.first.c_str(),
+               (unsigned long long)stats.metrics[METRIC_FRAME].GetCount(),
+               (unsigned long long)stats.missedDeadlines);
+        for (int m = 0; m < METRIC_COUNT; m++) {
+            const Histogram& h = stats.metrics[m];
+            printf("[FrameStats]   %-6s avg %7.3f  p50 %7.3f  p95 %7.3f  p99 %7.3f  max %7.3f ms\n",
+                   GetMetricName((Metric)m), h.GetAverageMs(), h.GetPercentileMs(50.0),
+                   h.GetPercentileMs(95.0), h.GetPercentileMs(99.0), h.GetMaxMs());
+        }
+    }
+}
+
+bool FrameStats::WriteJson(const std::string& path) const {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        printf("[FrameStats] Cannot write %s\n", path.c_str());
+        return false;
+    }
+
+    // Scene names come from GetStateName: plain identifiers, no escaping needed
+    fprintf(file, "{\n  \"deadline_ms\": %.4f,\n  \"scenes\": {", deadlineMs);
+    bool firstScene = true;
+    for (const auto& pair : scenes) {
+        const SceneStats& stats = pair.second;
+        fprintf(file, "%s\n    \"%s\": {\n      \"frames\": %llu,\n      \"missed_deadlines\": %llu",
+                firstScene ? "" : ",", pair.first.c_str(),
+                (unsigned long long)stats.metrics[METRIC_FRAME].GetCount(),
+                (unsigned long long)stats.missedDeadlines);
+        firstScene = false;
+
+        for (int m = 0; m < METRIC_COUNT; m++) {
+            const Histogram& h = stats.metrics[m];
+            fprintf(file, ",\n      \"%s\": {\"avg_ms\": %.4f, \"p50_ms\": %.4f, \"p95_ms\": %.4f, "
+                          "\"p99_ms\": %.4f, \"max_ms\": %.4f, \"histogram\": [",
+                    GetMetricName((Metric)m), h.GetAverageMs(), h.GetPercentileMs(50.0),
+                    h.GetPercentileMs(95.0), h.GetPercentileMs(99.0), h.GetMaxMs());
+
+            // Non-empty buckets only, as [upper bound ms, count]
+            bool firstBucket = true;
+            for (int b = 0; b < Histogram::BUCKETS; b++) {
+                if (!h.GetBucketCount(b)) continue;
+                fprintf(file, "%s[%.4f, %u]", firstBucket ? "" : ", ",
+                        Histogram::GetBucketUpperMs(b), h.GetBucketCount(b));
+                firstBucket = false;
+            }
+            fprintf(file, "]}");
+        }
+        fprintf(file, "\n    }");
+    }
+    fprintf(file, "\n  }\n}\n");
+
+    bool ok = !ferror(file);
+    fclose(file);
+    printf("[FrameStats] Wrote %s\n", path.c_str());
+    return ok;
+}
+
+bool FrameStats::WriteCsv(const std::string& path) const {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        printf("[FrameStats] Cannot write %s\n", path.c_str());
+        return false;
+    }
+
+    fprintf(file, "scene,metric,frames,missed_deadlines,avg_ms,p50_ms,p95_ms,p99_ms,max_ms\n");
+    for (const auto& pair : scenes) {
+        const SceneStats& stats = pair.second;
+        for (int m = 0; m < METRIC_COUNT; m++) {
+            const Histogram& h = stats.metrics[m];
+            fprintf(file, "%s,%s,%llu,%llu,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+                    pair.first.c_str(), GetMetricName((Metric)m), (unsigned long long)h.GetCount(),
+                    (unsigned long long)stats.missedDeadlines, h.GetAverageMs(), h.GetPercentileMs(50.0),
+                    h.GetPercentileMs(95.0), h.GetPercentileMs(99.0), h.GetMaxMs());
+        }
+    }
+
+    bool ok = !ferror(file);
+    fclose(file);
+    printf("[FrameStats] Wrote %s\n", path.c_str());
+    return ok;
+}
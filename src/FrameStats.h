@@ -0,0 +1,68 @@
+#pragma once
+// ============================================================================
+// FrameStats.h - Frame time histograms and percentiles per scene
+//
+// Every frame adds its update, render (submission), swap and total time to
+// fixed-size log-linear histograms: exact below 64 us, then 32 linear steps
+// per power of two (~3% resolution) up to ~16 s. Memory stays constant no
+// matter how long the app runs, and p50/p95/p99 come straight out of the
+// bucket counts. Frames longer than 1.5x the vsync period count as missed.
+// ============================================================================
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+class FrameStats {
+public:
+    enum Metric { METRIC_UPDATE, METRIC_RENDER, METRIC_SWAP, METRIC_FRAME, METRIC_COUNT };
+
+    class Histogram {
+    public:
+        static constexpr int SUB_BITS = 5;                  // 32 steps per octave
+        static constexpr int LINEAR_LIMIT = 2 << SUB_BITS;  // Exact below 64 us
+        static constexpr int MAX_BITS = 24;                 // ~16.7 s
+        static constexpr int BUCKETS = LINEAR_LIMIT + (MAX_BITS - SUB_BITS - 1) * (1 << SUB_BITS);
+
+        void Add(double ms);
+        uint64_t GetCount() const { return count; }
+        double GetAverageMs() const { return count ? sumUs / count / 1000.0 : 0.0; }
+        double GetMaxMs() const { return maxUs / 1000.0; }
+        double GetPercentileMs(double percentile) const;    // 0..100, bucket upper bound
+
+        // Raw access for dumps
+        uint32_t GetBucketCount(int bucket) const { return buckets[bucket]; }
+        static double GetBucketUpperMs(int bucket);
+
+    private:
+        uint32_t buckets[BUCKETS] = {};
+        uint64_t count = 0;
+        double sumUs = 0.0;
+        uint32_t maxUs = 0;
+
+        static int BucketFor(uint32_t us);
+    };
+
+    struct SceneStats {
+        Histogram metrics[METRIC_COUNT];
+        uint64_t missedDeadlines = 0;
+    };
+
+    // Frame budget for the missed-deadline count (display refresh period)
+    void SetDeadline(double seconds) { deadlineMs = seconds * 1000.0; }
+    double GetDeadlineMs() const { return deadlineMs; }
+
+    void AddFrame(const char* scene, double updateMs, double renderMs, double swapMs, double frameMs);
+    void Reset();
+
+    const std::map<std::string, SceneStats>& GetScenes() const { return scenes; }
+    static const char* GetMetricName(Metric metric);
+
+    void PrintSummary() const;
+    bool WriteJson(const std::string& path) const;
+    bool WriteCsv(const std::string& path) const;
+
+private:
+    std::map<std::string, SceneStats> scenes;   // Ordered, so dumps are stable
+    double deadlineMs = 1000.0 / 60.0;
+};
@@ -0,0 +1,176 @@
+#include "Platform.h"
+#include <GL/glew.h>
+#include "GpuProfiler.h"
+
+// ============================================================================
+// CpuScope Implementation
+// ============================================================================
+GpuProfiler::CpuScope::CpuScope(GpuProfiler& p, const char* s, const char* r)
+    : profiler(p), scope(s), region(r), start(SDL_GetPerformanceCounter()) {
+}
+
+GpuProfiler::CpuScope::~CpuScope() {
+    uint64_t elapsed = SDL_GetPerformanceCounter() - start;
+    float ms = (float)(elapsed * 1000.0 / (double)SDL_GetPerformanceFrequency());
+    profiler.AddCpuSample(scope, region, ms);
+}
+
+// ============================================================================
+// GpuProfiler Implementation
+// ============================================================================
+bool GpuProfiler::Init() {
+    // Timer queries are core in 3.3; keep the extension check for odd drivers
+    available = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+    printf("[GpuProfiler] GPU timers %s\n", available ? "enabled" : "unavailable (CPU only)");
+    return available;
+}
+
+void GpuProfiler::Shutdown() {
+    for (auto& frame : frames) {
+        if (!frame.pool.empty()) {
+            glDeleteQueries((GLsizei)frame.pool.size(), frame.pool.data());
+        }
+        frame.pool.clear();
+        frame.pending.clear();
+        frame.used = 0;
+    }
+    available = false;
+}
+
+void GpuProfiler::BeginFrame() {
+    if (!available) return;
+
+    frameIndex = (frameIndex + 1) % QUERY_LATENCY;
+    FrameQueries& frame = frames[frameIndex];
+    Collect(frame);
+
+    frame.pending.clear();
+    frame.used = 0;
+    frame.openRegion = -1;
+    inFrame = true;
+}
+
+void GpuProfiler::EndFrame() {
+    inFrame = false;
+}
+
+void GpuProfiler::SetScope(const char* newScope) {
+    scope = newScope ? newScope : "Global";
+}
+
+void GpuProfiler::BeginRegion(const char* region) {
+    if (!available || !inFrame) return;
+    FrameQueries& frame = frames[frameIndex];
+    if (frame.openRegion >= 0) return;     // One open region at a time
+
+    int index;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        index = FindRegion(scope, region);
+    }
+    frame.openRegion = index;
+    frame.openQuery = NextQuery(frame);
+    glQueryCounter(frame.openQuery, GL_TIMESTAMP);
+}
+
+void GpuProfiler::EndRegion(const char* region) {
+    if (!available || !inFrame) return;
+    FrameQueries& frame = frames[frameIndex];
+    if (frame.openRegion < 0) return;
+
+    uint32_t endQuery = NextQuery(frame);
+    glQueryCounter(endQuery, GL_TIMESTAMP);
+    frame.pending.push_back({ frame.openQuery, endQuery, frame.openRegion });
+    frame.openRegion = -1;
+    (void)region;
+}
+
+uint32_t GpuProfiler::NextQuery(FrameQueries& frame) {
+    if (frame.used == frame.pool.size()) {
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        frame.pool.push_back(query);
+    }
+    return frame.pool[frame.used++];
+}
+
+void GpuProfiler::Collect(FrameQueries& frame) {
+    if (frame.pending.empty()) return;
+
+    // Never wait: if the last query is not ready, the whole frame is dropped
+    GLint ready = 0;
+    glGetQueryObjectiv(frame.pending.back().end, GL_QUERY_RESULT_AVAILABLE, &ready);
+    if (!ready) return;
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    for (const PendingQuery& q : frame.pending) {
+        GLuint64 t0 = 0, t1 = 0;
+        glGetQueryObjectui64v(q.begin, GL_QUERY_RESULT, &t0);
+        glGetQueryObjectui64v(q.end, GL_QUERY_RESULT, &t1);
+        Region& r = regions[q.region];
+        r.gpuFrameNs += (double)(t1 - t0);
+        r.gpuTouched = true;
+    }
+
+    // One sample per region per frame (regions may be entered several times)
+    for (Region& r : regions) {
+        if (!r.gpuTouched) continue;
+        r.gpu[r.gpuHead] = (float)(r.gpuFrameNs / 1.0e6);
+        r.gpuHead = (r.gpuHead + 1) % HISTORY;
+        if (r.gpuCount < HISTORY) r.gpuCount++;
+        r.gpuFrameNs = 0.0;
+        r.gpuTouched = false;
+    }
+}
+
+void GpuProfiler::AddCpuSample(const char* sampleScope, const char* region, float ms) {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    Region& r = regions[FindRegion(sampleScope, region)];
+    r.cpu[r.cpuHead] = ms;
+    r.cpuHead = (r.cpuHead + 1) % HISTORY;
+    if (r.cpuCount < HISTORY) r.cpuCount++;
+}
+
+int GpuProfiler::FindRegion(const char* regionScope, const char* region) {
+    RegionKey key = { regionScope, region };
+    auto it = regionIndex.find(key);
+    if (it != regionIndex.end()) return it->second;
+
+    // First time this pointer pair is seen: match by name, else add a region
+    std::string name = std::string(regionScope) + "/" + region;
+    int index = -1;
+    for (size_t i = 0; i < regions.size(); i++) {
+        if (regions[i].name == name) {
+            index = (int)i;
+            break;
+        }
+    }
+    if (index < 0) {
+        regions.emplace_back();
+        regions.back().name = name;
+        index = (int)regions.size() - 1;
+    }
+    regionIndex[key] = index;
+    return index;
+}
+
+std::vector<GpuProfiler::RegionStats> GpuProfiler::GetStats() const {
+    std::vector<RegionStats> stats;
+    std::lock_guard<std::mutex> lock(statsMutex);
+    for (const Region& r : regions) {
+        RegionStats s;
+        s.name = r.name;
+        for (int i = 0; i < r.gpuCount; i++) {
+            s.gpuAvgMs += r.gpu[i];
+            if (r.gpu[i] > s.gpuMaxMs) s.gpuMaxMs = r.gpu[i];
+        }
+        for (int i = 0; i < r.cpuCount; i++) {
+            s.cpuAvgMs += r.cpu[i];
+            if (r.cpu[i] > s.cpuMaxMs) s.cpuMaxMs = r.cpu[i];
+        }
+        if (r.gpuCount) s.gpuAvgMs /= r.gpuCount;
+        if (r.cpuCount) s.cpuAvgMs /= r.cpuCount;
+        stats.push_back(s);
+    }
+    return stats;
+}
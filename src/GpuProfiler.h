@@ -0,0 +1,112 @@
+#pragma once
+// ============================================================================
+// GpuProfiler.h - GPU timer queries + CPU scoped timers
+//
+// GPU regions are bracketed with GL_TIMESTAMP queries. Regions are sequential:
+// only one is open at a time, and BeginRegion is ignored until the open one
+// ends. Queries are ring-buffered QUERY_LATENCY frames deep and
+// only read back once available, so the profiler never stalls the pipeline.
+// Samples are keyed "scope/region" (scope = current scene) and kept over a
+// rolling window for averages and maxima. Scope and region names must be
+// static strings: lookups go by pointer, the name is only built once.
+// ============================================================================
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+
+class GpuProfiler {
+public:
+    static constexpr int QUERY_LATENCY = 4;     // Frames in flight before readback
+    static constexpr int HISTORY = 120;         // Rolling window (frames)
+
+    struct RegionStats {
+        std::string name;       // "Scene/Region"
+        float gpuAvgMs = 0.0f;
+        float gpuMaxMs = 0.0f;
+        float cpuAvgMs = 0.0f;
+        float cpuMaxMs = 0.0f;
+    };
+
+    // Scoped CPU timer, e.g. GpuProfiler::CpuScope t(profiler, "Boot", "Update");
+    class CpuScope {
+    public:
+        CpuScope(GpuProfiler& profiler, const char* scope, const char* region);
+        ~CpuScope();
+    private:
+        GpuProfiler& profiler;
+        const char* scope;
+        const char* region;
+        uint64_t start;
+    };
+
+    bool Init();
+    void Shutdown();
+    bool IsAvailable() const { return available; }
+
+    // GL thread
+    void BeginFrame();              // Reads back the oldest frame's queries
+    void EndFrame();
+    void SetScope(const char* scope);
+    void BeginRegion(const char* region);  // No-op while another region is open
+    void EndRegion(const char* region);
+
+    // Any thread
+    void AddCpuSample(const char* scope, const char* region, float ms);
+    std::vector<RegionStats> GetStats() const;
+
+private:
+    struct Region {
+        std::string name;
+        float gpu[HISTORY] = {};
+        float cpu[HISTORY] = {};
+        int gpuCount = 0, gpuHead = 0;
+        int cpuCount = 0, cpuHead = 0;
+        double gpuFrameNs = 0.0;    // Accumulated while reading back one frame
+        bool gpuTouched = false;
+    };
+
+    struct PendingQuery {
+        uint32_t begin;
+        uint32_t end;
+        int region;
+    };
+
+    // Pointer pair -> regions index; equal names at different addresses share a region
+    struct RegionKey {
+        const char* scope;
+        const char* region;
+        bool operator==(const RegionKey& other) const {
+            return scope == other.scope && region == other.region;
+        }
+    };
+    struct RegionKeyHash {
+        size_t operator()(const RegionKey& key) const {
+            return std::hash<const void*>()(key.scope) * 31 ^ std::hash<const void*>()(key.region);
+        }
+    };
+
+    struct FrameQueries {
+        std::vector<uint32_t> pool;         // Query objects (reused)
+        std::vector<PendingQuery> pending;  // Regions issued this frame
+        size_t used = 0;
+        int openRegion = -1;
+        uint32_t openQuery = 0;
+    };
+
+    bool available = false;
+    bool inFrame = false;
+    const char* scope = "Global";
+    int frameIndex = 0;
+    FrameQueries frames[QUERY_LATENCY];
+
+    mutable std::mutex statsMutex;
+    std::vector<Region> regions;
+    std::unordered_map<RegionKey, int, RegionKeyHash> regionIndex;
+
+    int FindRegion(const char* scope, const char* region);     // statsMutex held
+    uint32_t NextQuery(FrameQueries& frame);
+    void Collect(FrameQueries& frame);
+};
@@ -137,4 +137,32 @@ namespace Math {
             Lerp(a.z, b.z, t)
         );
     }
+
+    // Bounding sphere of positions (3 floats every strideBytes): centered on
+    // the AABB, radius to the farthest point. Not minimal, never too small
+    inline void BoundingSphere(const void* positions, size_t count, size_t strideBytes,
+                               Vec3& center, float& radius) {
+        center = Vec3(0.0f);
+        radius = 0.0f;
+        if (count == 0) return;
+
+        const uint8_t* base = static_cast<const uint8_t*>(positions);
+        const float* first = reinterpret_cast<const float*>(base);
+        Vec3 lo(first[0], first[1], first[2]);
+        Vec3 hi = lo;
+        for (size_t i = 1; i < count; i++) {
+            const float* p = reinterpret_cast<const float*>(base + i * strideBytes);
+            lo = Vec3(fminf(lo.x, p[0]), fminf(lo.y, p[1]), fminf(lo.z, p[2]));
+            hi = Vec3(fmaxf(hi.x, p[0]), fmaxf(hi.y, p[1]), fmaxf(hi.z, p[2]));
+        }
+        center = (lo + hi) * 0.5f;
+
+        float maxSq = 0.0f;
+        for (size_t i = 0; i < count; i++) {
+            const float* p = reinterpret_cast<const float*>(base + i * strideBytes);
+            Vec3 d(p[0] - center.x, p[1] - center.y, p[2] - center.z);
+            maxSq = fmaxf(maxSq, d.x * d.x + d.y * d.y + d.z * d.z);
+        }
+        radius = sqrtf(maxSq);
+    }
 }
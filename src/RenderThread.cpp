@@ -0,0 +1,125 @@
+#include "Platform.h"
+#include <GL/glew.h>
+#include "RenderThread.h"
+#include "Renderer.h"
+
+// ============================================================================
+// RenderThread Implementation
+// ============================================================================
+bool RenderThread::Start(SDL_Window* win, void* glContext, Renderer& target) {
+    if (running) return true;
+
+    window = win;
+    context = glContext;
+    renderer = &target;
+    quit = false;
+    recordIndex = replayIndex = 0;
+    for (auto& p : pending) p = false;
+
+    // The context can only be current on one thread at a time
+    if (SDL_GL_MakeCurrent(window, nullptr) != 0) {
+        printf("[RenderThread] Failed to release GL context: %s\n", SDL_GetError());
+        return false;
+    }
+
+    running = true;
+    renderer->SetRenderThread(this);
+    thread = std::thread(&RenderThread::ThreadMain, this);
+
+    printf("[RenderThread] Started (%d command lists in flight)\n", LIST_COUNT);
+    return true;
+}
+
+void RenderThread::Stop() {
+    if (!running) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quit = true;
+    }
+    cv.notify_all();
+    thread.join();
+    threadId = std::thread::id();
+
+    running = false;
+    renderer->SetRenderThread(nullptr);
+    SDL_GL_MakeCurrent(window, (SDL_GLContext)context);
+
+    printf("[RenderThread] Stopped\n");
+}
+
+CommandList& RenderThread::AcquireList() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return !pending[recordIndex]; });
+    return lists[recordIndex];
+}
+
+void RenderThread::SubmitList() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending[recordIndex] = true;
+        recordIndex = (recordIndex + 1) % LIST_COUNT;
+    }
+    cv.notify_all();
+}
+
+void RenderThread::Invoke(const std::function<void()>& fn) {
+    if (!running || IsCurrent()) {
+        fn();
+        return;
+    }
+
+    Job job = { &fn, false };
+    std::unique_lock<std::mutex> lock(mutex);
+    jobs.push_back(&job);
+    cv.notify_all();
+    cv.wait(lock, [&job] { return job.done; });
+}
+
+void RenderThread::ThreadMain() {
+    threadId = std::this_thread::get_id();
+    SDL_GL_MakeCurrent(window, (SDL_GLContext)context);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        cv.wait(lock, [this] { return quit || !jobs.empty() || pending[replayIndex]; });
+
+        // Resource calls first: the main thread is blocked on them
+        if (!jobs.empty()) {
+            Job* job = jobs.front();
+            jobs.pop_front();
+            lock.unlock();
+            (*job->fn)();
+            lock.lock();
+            job->done = true;
+            cv.notify_all();
+            continue;
+        }
+
+        if (pending[replayIndex]) {
+            CommandList& list = lists[replayIndex];
+            lock.unlock();
+
+            renderer->BeginFrame();
+            {
+                GpuProfiler::CpuScope timer(renderer->GetProfiler(),
+                                            list.profileScope ? list.profileScope : "Global", "Replay");
+                renderer->Execute(list);
+            }
+            renderer->EndFrame();
+            SDL_GL_SwapWindow(window);
+
+            lock.lock();
+            pending[replayIndex] = false;
+            replayIndex = (replayIndex + 1) % LIST_COUNT;
+            cv.notify_all();
+            continue;
+        }
+
+        if (quit) break;
+    }
+    lock.unlock();
+
+    // Give the context back so Stop() can make it current on the caller
+    SDL_GL_MakeCurrent(window, nullptr);
+}
@@ -0,0 +1,68 @@
+#pragma once
+// ============================================================================
+// RenderThread.h - Dedicated GL submission thread
+//
+// Owns the GL context while running. The main thread records frame N+1 into
+// one CommandList while this thread sorts, replays and swaps frame N.
+// Resource calls made from other threads are marshalled with Invoke().
+// ============================================================================
+
+#include "CommandList.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+
+struct SDL_Window;
+class Renderer;
+
+class RenderThread {
+public:
+    static constexpr int LIST_COUNT = 2;    // Frames recorded ahead of replay
+
+    RenderThread() = default;
+    ~RenderThread() { Stop(); }
+
+    // Hands the context over to the new thread (caller must own it)
+    bool Start(SDL_Window* window, void* glContext, Renderer& renderer);
+    // Replays anything pending, joins and makes the context current again on the caller
+    void Stop();
+
+    bool IsRunning() const { return running; }
+    bool IsCurrent() const { return std::this_thread::get_id() == threadId.load(); }
+
+    // Main thread: get the next free list (waits while both are in flight)
+    CommandList& AcquireList();
+    // Main thread: queue the acquired list for replay and return immediately
+    void SubmitList();
+
+    // Run fn on the render thread and wait for it (between frames)
+    void Invoke(const std::function<void()>& fn);
+
+private:
+    struct Job {
+        const std::function<void()>* fn;
+        bool done;
+    };
+
+    SDL_Window* window = nullptr;
+    void* context = nullptr;
+    Renderer* renderer = nullptr;
+    bool running = false;
+
+    std::thread thread;
+    std::atomic<std::thread::id> threadId{};   // Set by ThreadMain; `thread` is assigned concurrently
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool quit = false;
+
+    CommandList lists[LIST_COUNT];
+    bool pending[LIST_COUNT] = {};  // Submitted and not yet replayed
+    int recordIndex = 0;
+    int replayIndex = 0;
+    std::deque<Job*> jobs;
+
+    void ThreadMain();
+};
@@ -3,8 +3,11 @@
 #include <GL/glew.h>
 #include "Renderer.h"
 #include "Assets.h"
+#include "RenderThread.h"
+#include "TextCodec.h"
 #include <cmath>
 #include <vector>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -31,32 +34,340 @@ void Shader::Use() const {
     }
 }
 
+void Shader::Reflect() {
+    locations.clear();
+
+    GLint count = 0;
+    GLint maxLength = 0;
+    glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+    std::vector<char> name(maxLength > 0 ? maxLength : 1);
+    for (GLint i = 0; i < count; i++) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(id, (GLuint)i, (GLsizei)name.size(), &length, &size, &type, name.data());
+
+        // Uniform block members have no location
+        GLint location = glGetUniformLocation(id, name.data());
+        if (location < 0) continue;
+
+        // Arrays are reported as "name[0]"; store them under the bare name
+        std::string key(name.data(), length);
+        if (key.size() > 3 && key.compare(key.size() - 3, 3, "[0]") == 0) {
+            key.resize(key.size() - 3);
+        }
+        locations[key] = location;
+    }
+
+    GLuint block = glGetUniformBlockIndex(id, "FrameUniforms");
+    if (block != GL_INVALID_INDEX) {
+        glUniformBlockBinding(id, block, FrameUniforms::BINDING);
+    }
+}
+
+int Shader::Location(const char* name) const {
+    auto it = locations.find(name);
+    return it != locations.end() ? it->second : -1;
+}
+
 void Shader::SetInt(const char* name, int value) const {
-    glUniform1i(glGetUniformLocation(id, name), value);
+    glUniform1i(Location(name), value);
 }
 
 void Shader::SetFloat(const char* name, float value) const {
-    glUniform1f(glGetUniformLocation(id, name), value);
+    glUniform1f(Location(name), value);
 }
 
 void Shader::SetVec3(const char* name, const Vec3& value) const {
-    glUniform3f(glGetUniformLocation(id, name), value.x, value.y, value.z);
+    glUniform3f(Location(name), value.x, value.y, value.z);
 }
 
 void Shader::SetVec3(const char* name, float x, float y, float z) const {
-    glUniform3f(glGetUniformLocation(id, name), x, y, z);
+    glUniform3f(Location(name), x, y, z);
+}
+
+void Shader::SetVec2(const char* name, float x, float y) const {
+    glUniform2f(Location(name), x, y);
+}
+
+void Shader::SetIVec2(const char* name, int x, int y) const {
+    glUniform2i(Location(name), x, y);
 }
 
 void Shader::SetVec4(const char* name, float x, float y, float z, float w) const {
-    glUniform4f(glGetUniformLocation(id, name), x, y, z, w);
+    glUniform4f(Location(name), x, y, z, w);
 }
 
 void Shader::SetMat4(const char* name, const float* matrix) const {
-    glUniformMatrix4fv(glGetUniformLocation(id, name), 1, GL_FALSE, matrix);
+    glUniformMatrix4fv(Location(name), 1, GL_FALSE, matrix);
 }
 
 void Shader::SetBool(const char* name, bool value) const {
-    glUniform1i(glGetUniformLocation(id, name), value ? 1 : 0);
+    glUniform1i(Location(name), value ? 1 : 0);
+}
+
+// ============================================================================
+// StreamBuffer Implementation
+// ============================================================================
+static void WaitAndDeleteFence(void*& fence) {
+    if (!fence) return;
+    GLsync sync = (GLsync)fence;
+    GLenum result = glClientWaitSync(sync, 0, 0);
+    while (result == GL_TIMEOUT_EXPIRED) {
+        result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1ms
+    }
+    glDeleteSync(sync);
+    fence = nullptr;
+}
+
+bool StreamBuffer::Create(size_t bytes) {
+    size = (bytes / SEGMENT_COUNT) * SEGMENT_COUNT;
+    head = 0;
+    segment = 0;
+
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, id);
+
+    if (GLEW_ARB_buffer_storage) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+        mapped = (uint8_t*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags);
+        if (!mapped) {
+            // Storage is immutable, start over with a regular buffer
+            glDeleteBuffers(1, &id);
+            glGenBuffers(1, &id);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, id);
+        }
+    }
+    if (!mapped) {
+        glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    printf("[StreamBuffer] Created %zu KB ring (%s)\n", size / 1024,
+           mapped ? "persistent" : "unsynchronized map");
+    return id != 0;
+}
+
+void StreamBuffer::Destroy() {
+    for (auto& fence : fences) {
+        if (fence) {
+            glDeleteSync((GLsync)fence);
+            fence = nullptr;
+        }
+    }
+    if (id) {
+        if (mapped) {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, id);
+            glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            mapped = nullptr;
+        }
+        glDeleteBuffers(1, &id);
+        id = 0;
+    }
+    size = head = 0;
+    segment = 0;
+}
+
+size_t StreamBuffer::Push(const void* data, size_t bytes, size_t alignment) {
+    const size_t segmentSize = size / SEGMENT_COUNT;
+    if (!id || bytes == 0 || bytes > segmentSize) {
+        return SIZE_MAX;
+    }
+
+    size_t offset = ((head + alignment - 1) / alignment) * alignment;
+    if (offset + bytes > size) {
+        offset = 0; // Wrap around
+    }
+
+    // Fence every segment the head leaves, wait for every segment it enters
+    int lastSegment = (int)((offset + bytes - 1) / segmentSize);
+    while (segment != lastSegment) {
+        fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        segment = (segment + 1) % SEGMENT_COUNT;
+        WaitAndDeleteFence(fences[segment]);
+    }
+
+    if (mapped) {
+        memcpy(mapped + offset, data, bytes);
+    } else {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, id);
+        void* dst = glMapBufferRange(GL_COPY_WRITE_BUFFER, offset, bytes,
+            GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+        if (!dst) {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            return SIZE_MAX;
+        }
+        memcpy(dst, data, bytes);
+        glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+
+    head = offset + bytes;
+    return offset;
+}
+
+// ============================================================================
+// RenderStats Implementation
+// ============================================================================
+void RenderStats::ResetDraws() {
+    drawCalls = 0;
+    for (int& count : drawCallsByPrimitive) count = 0;
+    quadBatches = 0;
+    vertices = indices = instances = 0;
+    culledDraws = 0;
+    culledInstances = 0;
+    textureBinds = programSwitches = 0;
+    stateCallsIssued = stateCallsElided = 0;
+}
+
+// ============================================================================
+// RenderState Implementation
+// ============================================================================
+void RenderState::Invalidate() {
+    program = UINT32_MAX;
+    vao = UINT32_MAX;
+    activeUnit = UINT32_MAX;
+    for (auto& tex : textures) tex = UINT32_MAX;
+    for (auto& tex : textureArrays) tex = UINT32_MAX;
+    blend = -1;
+    depthTest = -1;
+    cullFace = -1;
+    blendSrc = UINT32_MAX;
+    blendDst = UINT32_MAX;
+    lineWidth = -1.0f;
+}
+
+void RenderState::UseProgram(uint32_t id) {
+    if (program == id) { elided++; return; }
+    glUseProgram(id);
+    program = id;
+    issued++;
+    programSwitches++;
+}
+
+void RenderState::BindVertexArray(uint32_t id) {
+    if (vao == id) { elided++; return; }
+    glBindVertexArray(id);
+    vao = id;
+    issued++;
+}
+
+static void BindTextureTarget(RenderState& s, uint32_t* shadow, GLenum target, uint32_t unit, uint32_t id) {
+    if (unit >= RenderState::TEXTURE_UNITS) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(target, id);
+        s.activeUnit = unit;
+        s.issued += 2;
+        s.textureBinds++;
+        return;
+    }
+    if (shadow[unit] == id) { s.elided++; return; }
+    if (s.activeUnit != unit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        s.activeUnit = unit;
+        s.issued++;
+    }
+    glBindTexture(target, id);
+    shadow[unit] = id;
+    s.issued++;
+    s.textureBinds++;
+}
+
+void RenderState::BindTexture(uint32_t unit, uint32_t id) {
+    BindTextureTarget(*this, textures, GL_TEXTURE_2D, unit, id);
+}
+
+void RenderState::BindTextureArray(uint32_t unit, uint32_t id) {
+    BindTextureTarget(*this, textureArrays, GL_TEXTURE_2D_ARRAY, unit, id);
+}
+
+static void SetCapability(int& shadow, GLenum cap, bool enabled, int& issued, int& elided) {
+    if (shadow == (enabled ? 1 : 0)) { elided++; return; }
+    if (enabled) glEnable(cap); else glDisable(cap);
+    shadow = enabled ? 1 : 0;
+    issued++;
+}
+
+void RenderState::SetBlend(bool enabled) {
+    SetCapability(blend, GL_BLEND, enabled, issued, elided);
+}
+
+void RenderState::SetDepthTest(bool enabled) {
+    SetCapability(depthTest, GL_DEPTH_TEST, enabled, issued, elided);
+}
+
+void RenderState::SetCullFace(bool enabled) {
+    SetCapability(cullFace, GL_CULL_FACE, enabled, issued, elided);
+}
+
+void RenderState::SetBlendFunc(uint32_t src, uint32_t dst) {
+    if (blendSrc == src && blendDst == dst) { elided++; return; }
+    glBlendFunc(src, dst);
+    blendSrc = src;
+    blendDst = dst;
+    issued++;
+}
+
+void RenderState::SetLineWidth(float width) {
+    if (lineWidth == width) { elided++; return; }
+    glLineWidth(width);
+    lineWidth = width;
+    issued++;
+}
+
+void RenderState::ForgetProgram(uint32_t id) {
+    if (program == id) program = UINT32_MAX;
+}
+
+void RenderState::ForgetVertexArray(uint32_t id) {
+    if (vao == id) vao = 0;
+}
+
+void RenderState::ForgetTexture(uint32_t id) {
+    for (auto& tex : textures) {
+        if (tex == id) tex = 0;
+    }
+    for (auto& tex : textureArrays) {
+        if (tex == id) tex = 0;
+    }
+}
+
+// ============================================================================
+// Mesh Helpers
+// ============================================================================
+static const float IDENTITY_MATRIX[16] = {
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f
+};
+
+// ICOB vertices -> pos.xyz + color.rgba (basic shader layout)
+static void PackMeshVertices(const ICOBModel& mesh, std::vector<float>& out) {
+    out.clear();
+    out.reserve(mesh.vertices.size() * 7);
+    for (const auto& v : mesh.vertices) {
+        out.push_back(v.position.x);
+        out.push_back(v.position.y);
+        out.push_back(v.position.z);
+        out.push_back(v.color.r);
+        out.push_back(v.color.g);
+        out.push_back(v.color.b);
+        out.push_back(v.color.a);
+    }
+}
+
+// Immutable storage when available, plain static buffer otherwise
+static void UploadStaticBuffer(GLenum target, size_t bytes, const void* data) {
+    if (GLEW_ARB_buffer_storage) {
+        glBufferStorage(target, bytes, data, 0);
+    } else {
+        glBufferData(target, bytes, data, GL_STATIC_DRAW);
+    }
 }
 
 // ============================================================================
@@ -70,13 +381,23 @@ layout (location = 1) in vec4 aColor;
 out vec3 FragPos;
 out vec4 VertexColor;
 
-uniform mat4 uProjection;
-uniform mat4 uView;
+layout (std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    mat4 uOrtho;
+    vec3 fogColor;
+    float fogDensity;
+    vec3 viewPos;
+    float uTime;
+};
+uniform mat4 uModel;
+uniform vec4 uTint;
 
 void main() {
-    FragPos = aPos;
-    VertexColor = aColor;
-    gl_Position = uProjection * uView * vec4(aPos, 1.0);
+    vec4 worldPos = uModel * vec4(aPos, 1.0);
+    FragPos = worldPos.xyz;
+    VertexColor = aColor * uTint;
+    gl_Position = uProjection * uView * worldPos;
 }
 )";
 
@@ -86,10 +407,17 @@ in vec3 FragPos;
 in vec4 VertexColor;
 out vec4 FragColor;
 
+layout (std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    mat4 uOrtho;
+    vec3 fogColor;
+    float fogDensity;
+    vec3 viewPos;
+    float uTime;
+};
+
 uniform bool fogEnabled;
-uniform float fogDensity;
-uniform vec3 fogColor;
-uniform vec3 viewPos;
 
 void main() {
     vec4 color = VertexColor;
@@ -105,31 +433,67 @@ void main() {
 }
 )";
 
+static const char* fallbackInstancedVertShader = R"(
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec4 aColor;
+layout (location = 2) in mat4 aModel;
+layout (location = 6) in vec4 aInstanceColor;
+
+out vec3 FragPos;
+out vec4 VertexColor;
+
+layout (std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    mat4 uOrtho;
+    vec3 fogColor;
+    float fogDensity;
+    vec3 viewPos;
+    float uTime;
+};
+
+void main() {
+    vec4 worldPos = aModel * vec4(aPos, 1.0);
+    FragPos = worldPos.xyz;
+    VertexColor = aColor * aInstanceColor;
+    gl_Position = uProjection * uView * worldPos;
+}
+)";
+
 static const char* fallbackTextVertShader = R"(
 #version 330 core
 layout (location = 0) in vec2 aPos;
-layout (location = 1) in vec2 aTexCoord;
+layout (location = 1) in vec3 aTexCoord;
 layout (location = 2) in vec4 aColor;
 
-out vec2 TexCoord;
+out vec3 TexCoord;
 out vec4 VertexColor;
 
-uniform mat4 uProjection;
+layout (std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    mat4 uOrtho;
+    vec3 fogColor;
+    float fogDensity;
+    vec3 viewPos;
+    float uTime;
+};
 
 void main() {
     TexCoord = aTexCoord;
     VertexColor = aColor;
-    gl_Position = uProjection * vec4(aPos, 0.0, 1.0);
+    gl_Position = uOrtho * vec4(aPos, 0.0, 1.0);
 }
 )";
 
 static const char* fallbackTextFragShader = R"(
 #version 330 core
-in vec2 TexCoord;
+in vec3 TexCoord;
 in vec4 VertexColor;
 out vec4 FragColor;
 
-uniform sampler2D uFontAtlas;
+uniform sampler2DArray uFontAtlas;
 
 void main() {
     vec4 texColor = texture(uFontAtlas, TexCoord);
@@ -146,12 +510,20 @@ layout (location = 2) in vec4 aColor;
 out vec2 TexCoord;
 out vec4 VertexColor;
 
-uniform mat4 uProjection;
+layout (std140) uniform FrameUniforms {
+    mat4 uProjection;
+    mat4 uView;
+    mat4 uOrtho;
+    vec3 fogColor;
+    float fogDensity;
+    vec3 viewPos;
+    float uTime;
+};
 
 void main() {
     TexCoord = aTexCoord;
     VertexColor = aColor;
-    gl_Position = uProjection * vec4(aPos, 0.0, 1.0);
+    gl_Position = uOrtho * vec4(aPos, 0.0, 1.0);
 }
 )";
 
@@ -174,6 +546,243 @@ void main() {
 }
 )";
 
+static const char* fallbackGsSpriteFragShader = R"(
+#version 330 core
+in vec2 TexCoord;
+in vec4 VertexColor;
+out vec4 FragColor;
+
+uniform usampler2D uGsData;
+uniform sampler2D uClut;
+uniform bool uHasClut;
+uniform int uPsm;
+uniform ivec2 uSize;
+
+const int DATA_WIDTH = 256;
+
+const int block32[32] = int[](
+    0, 1, 4, 5, 16, 17, 20, 21, 2, 3, 6, 7, 18, 19, 22, 23,
+    8, 9, 12, 13, 24, 25, 28, 29, 10, 11, 14, 15, 26, 27, 30, 31
+);
+const int block16[32] = int[](
+    0, 2, 8, 10, 1, 3, 9, 11, 4, 6, 12, 14, 5, 7, 13, 15,
+    16, 18, 24, 26, 17, 19, 25, 27, 20, 22, 28, 30, 21, 23, 29, 31
+);
+
+uint Fetch(int index) {
+    return texelFetch(uGsData, ivec2(index % DATA_WIDTH, index / DATA_WIDTH), 0).r;
+}
+
+vec4 Indexed(uint index, float maskAlpha) {
+    if (uHasClut) return texelFetch(uClut, ivec2(int(index), 0), 0);
+    return vec4(1.0, 1.0, 1.0, maskAlpha);
+}
+
+vec4 Decode(int x, int y) {
+    int w = uSize.x;
+    if (uPsm == 0) {
+        int page = (x >> 6) + (y >> 5) * ((w + 63) >> 6);
+        int ox = x & 63, oy = y & 31;
+        uint v = Fetch(page * 2048 + block32[(oy >> 3) * 8 + (ox >> 3)] * 64 + (oy & 7) * 8 + (ox & 7));
+        vec3 rgb = vec3(uvec3(v, v >> 8u, v >> 16u) & 0xFFu) / 255.0;
+        return vec4(rgb, min(float(v >> 24u) * 2.0, 255.0) / 255.0);
+    }
+    if (uPsm == 1) {
+        int addr = (y * w + x) * 3;
+        return vec4(float(Fetch(addr)), float(Fetch(addr + 1)), float(Fetch(addr + 2)), 255.0) / 255.0;
+    }
+    if (uPsm == 2 || uPsm == 3) {
+        int page = (x >> 6) + (y >> 6) * ((w + 63) >> 6);
+        int ox = x & 63, oy = y & 63;
+        uint raw = Fetch(page * 4096 + block16[(oy >> 3) * 4 + (ox >> 4)] * 128 + (oy & 7) * 16 + (ox & 15));
+        uvec3 c = (uvec3(raw, raw >> 5u, raw >> 10u) & 0x1Fu) << 3u;
+        c |= c >> 5u;
+        bool visible = (raw >> 15u) != 0u || any(notEqual(c, uvec3(0u)));
+        return vec4(vec3(c) / 255.0, visible ? 1.0 : 0.0);
+    }
+    if (uPsm == 4 || uPsm == 5) {
+        int page = (x >> 7) + (y >> 6) * ((w + 127) >> 7);
+        int ox = x & 127, oy = y & 63;
+        uint val = Fetch(page * 8192 + block32[(oy >> 4) * 8 + (ox >> 4)] * 256 + (oy & 15) * 16 + (ox & 15));
+        return Indexed(val, val > 128u ? 1.0 : float(val * 2u) / 255.0);
+    }
+    if (uPsm >= 6) {
+        int pixel = y * w + x;
+        uint v = (Fetch(pixel >> 1) >> uint((pixel & 1) * 4)) & 0xFu;
+        return Indexed(v, float(v * 17u) / 255.0);
+    }
+    return vec4(1.0, 0.0, 1.0, 1.0);
+}
+
+void main() {
+    ivec2 p = clamp(ivec2(TexCoord * vec2(uSize)), ivec2(0), uSize - 1);
+    FragColor = Decode(p.x, p.y) * VertexColor;
+}
+)";
+
+static const char* fallbackPostFxVertShader = R"(
+#version 330 core
+
+// Fullscreen triangle para o pós-processamento
+// Sem vertex buffer: posições geradas a partir de gl_VertexID
+
+out vec2 TexCoord;
+
+void main() {
+    vec2 pos = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+    TexCoord = pos;
+    gl_Position = vec4(pos * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+static const char* fallbackPostFxFragShader = R"(
+#version 330 core
+
+// Post-processing shader
+// Bloom (composição) + Dithering (efeitos do PS2) + upscale da resolução interna
+// (o fog é aplicado por fragmento no basic.frag)
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+uniform sampler2D screenTexture;    // Cena na resolução interna (GL_LINEAR)
+uniform vec2 sourceSize;            // Resolução interna em pixels
+uniform vec2 outputSize;            // Viewport de saída em pixels
+uniform bool sharpFilter;           // Sharp-bilinear (true) ou nearest (false)
+
+// Bloom settings
+uniform bool bloomEnabled;
+uniform float bloomIntensity;
+uniform sampler2D bloomTexture;     // Nível 0 da cadeia de bloom (meia resolução)
+
+// Dithering matrix 4x4 (PS2 style)
+const float dither[16] = float[](
+    0.0,  8.0,  2.0, 10.0,
+    12.0, 4.0, 14.0,  6.0,
+    3.0, 11.0,  1.0,  9.0,
+    15.0, 7.0, 13.0,  5.0
+);
+
+float getDither(vec2 coord) {
+    int x = int(mod(coord.x, 4.0));
+    int y = int(mod(coord.y, 4.0));
+    return dither[y * 4 + x] / 16.0;
+}
+
+// Nearest: centro do texel. Sharp-bilinear: pixels inteiros nítidos, só a
+// borda entre texels é interpolada (evita o shimmer de escalas não inteiras)
+vec2 upscaleCoord(vec2 uv) {
+    vec2 texel = uv * sourceSize;
+    vec2 texelFloor = floor(texel);
+    if (!sharpFilter) {
+        return (texelFloor + 0.5) / sourceSize;
+    }
+
+    vec2 scale = max(floor(outputSize / sourceSize), vec2(1.0));
+    vec2 region = 0.5 - 0.5 / scale;
+    vec2 centerDist = fract(texel) - 0.5;
+    vec2 f = (centerDist - clamp(centerDist, -region, region)) * scale + 0.5;
+    return (texelFloor + f) / sourceSize;
+}
+
+void main() {
+    vec4 color = texture(screenTexture, upscaleCoord(TexCoord));
+    
+    // Bloom (cadeia de downsample/upsample, ver bloom_down/bloom_up)
+    if (bloomEnabled) {
+        color.rgb += texture(bloomTexture, TexCoord).rgb * bloomIntensity;
+    }
+    
+    // Dithering (PS2 style - na grade de pixels interna, escala junto com a imagem)
+    float ditherValue = getDither(floor(TexCoord * sourceSize));
+    color.rgb += (ditherValue - 0.5) * 0.02; // Subtle dithering
+    
+    // Clamp
+    color = clamp(color, 0.0, 1.0);
+    
+    FragColor = color;
+}
+)";
+
+static const char* fallbackBloomDownFragShader = R"(
+#version 330 core
+
+// Bloom: downsample (dual filter, 5 taps) com bright-pass no primeiro nível
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+uniform sampler2D sourceTexture;
+uniform vec2 texelSize;     // 1 / tamanho da textura de origem
+uniform bool brightPass;    // Só no primeiro nível (cena -> meia resolução)
+uniform float threshold;
+uniform float knee;         // Transição suave em torno do threshold
+
+vec3 applyBrightPass(vec3 color) {
+    float brightness = max(color.r, max(color.g, color.b));
+    float soft = clamp(brightness - threshold + knee, 0.0, 2.0 * knee);
+    soft = soft * soft / (4.0 * knee + 0.0001);
+    float contribution = max(soft, brightness - threshold) / max(brightness, 0.0001);
+    return color * contribution;
+}
+
+void main() {
+    vec2 halfTexel = texelSize * 0.5;
+    vec3 sum = texture(sourceTexture, TexCoord).rgb * 4.0;
+    sum += texture(sourceTexture, TexCoord - halfTexel).rgb;
+    sum += texture(sourceTexture, TexCoord + halfTexel).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(halfTexel.x, -halfTexel.y)).rgb;
+    sum += texture(sourceTexture, TexCoord - vec2(halfTexel.x, -halfTexel.y)).rgb;
+
+    vec3 color = sum / 8.0;
+    if (brightPass) {
+        color = applyBrightPass(color);
+    }
+    FragColor = vec4(color, 1.0);
+}
+)";
+
+static const char* fallbackBloomUpFragShader = R"(
+#version 330 core
+
+// Bloom: upsample (dual filter, 8 taps em tenda)
+// Somado ao nível maior com blend aditivo
+
+in vec2 TexCoord;
+out vec4 FragColor;
+
+uniform sampler2D sourceTexture;
+uniform vec2 texelSize;     // 1 / tamanho da textura de origem (nível menor)
+
+void main() {
+    vec2 h = texelSize * 0.5;
+    vec3 sum = texture(sourceTexture, TexCoord + vec2(-h.x * 2.0, 0.0)).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(-h.x, h.y)).rgb * 2.0;
+    sum += texture(sourceTexture, TexCoord + vec2(0.0, h.y * 2.0)).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(h.x, h.y)).rgb * 2.0;
+    sum += texture(sourceTexture, TexCoord + vec2(h.x * 2.0, 0.0)).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(h.x, -h.y)).rgb * 2.0;
+    sum += texture(sourceTexture, TexCoord + vec2(0.0, -h.y * 2.0)).rgb;
+    sum += texture(sourceTexture, TexCoord + vec2(-h.x, -h.y)).rgb * 2.0;
+    FragColor = vec4(sum / 12.0, 1.0);
+}
+)";
+
+// ============================================================================
+// Recorded Packet Arguments (POD, copied into the CommandList arena)
+// ============================================================================
+struct CubeArgs     { Vec3 position, scale, rotation; Color color; };
+struct SphereArgs   { Vec3 position; float radius; Color color; int segments; };
+struct GpuMeshArgs  { GpuMesh mesh; Vec3 position, scale, rotation; Color color; };
+struct InstanceArgs { uint32_t count; int segments; };          // + InstanceData[count]
+struct LineArgs     { Vec3 start, end; Color color; float width; };
+struct RectArgs     { float x, y, w, h; Color color; };
+struct SpriteArgs   { Texture tex; float x, y, w, h; Color tint; };
+struct GsSpriteArgs { GsTexture tex; float x, y, w, h; Color tint; };
+struct TextArgs     { float x, y, scale, width; TextAlign align; Color color; uint32_t length; };  // + chars
+
+thread_local CommandList* Renderer::recordTarget = nullptr;
+
 // ============================================================================
 // Renderer Implementation
 // ============================================================================
@@ -191,13 +800,14 @@ Renderer::~Renderer() {
 bool Renderer::Init() {
     printf("[Renderer] Initializing...\n");
 
-    glEnable(GL_DEPTH_TEST);
+    state.Invalidate();
+    state.SetDepthTest(true);
     glDepthFunc(GL_LESS);
     
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    state.SetBlend(true);
+    state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     
-    glEnable(GL_CULL_FACE);
+    state.SetCullFace(true);
     glCullFace(GL_BACK);
     
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1); 
@@ -207,14 +817,101 @@ bool Renderer::Init() {
         return false;
     }
 
-    // Main VAO/VBO for 3D geometry
+    // Samplers never change, set them once
+    if (textShader.valid) {
+        state.UseProgram(textShader.id);
+        textShader.SetInt("uFontAtlas", 0);
+    }
+    if (spriteShader.valid) {
+        state.UseProgram(spriteShader.id);
+        spriteShader.SetInt("uTexture", 0);
+    }
+    if (gsSpriteShader.valid) {
+        state.UseProgram(gsSpriteShader.id);
+        gsSpriteShader.SetInt("uGsData", 0);
+        gsSpriteShader.SetInt("uClut", 1);
+    }
+    if (postFxShader.valid) {
+        state.UseProgram(postFxShader.id);
+        postFxShader.SetInt("screenTexture", 0);
+        postFxShader.SetInt("bloomTexture", 1);
+    }
+    if (bloomDownShader.valid) {
+        state.UseProgram(bloomDownShader.id);
+        bloomDownShader.SetInt("sourceTexture", 0);
+    }
+    if (bloomUpShader.valid) {
+        state.UseProgram(bloomUpShader.id);
+        bloomUpShader.SetInt("sourceTexture", 0);
+    }
+
+    // Per-frame uniform block, bound once to its fixed binding point
+    glGenBuffers(1, &frameUbo);
+    glBindBuffer(GL_UNIFORM_BUFFER, frameUbo);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameUniforms), nullptr, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, FrameUniforms::BINDING, frameUbo);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // Streaming ring buffers for all per-frame geometry
+    if (!vertexStream.Create(VERTEX_STREAM_SIZE) || !indexStream.Create(INDEX_STREAM_SIZE)) {
+        printf("[Renderer] Failed to create stream buffers!\n");
+        return false;
+    }
+    if (!uploadStream.Create(UPLOAD_STREAM_SIZE)) {
+        printf("[Renderer] Warning: No texture upload ring, uploading from client memory\n");
+    }
+
+    // 3D VAO: pos.xyz + color.rgba
     glGenVertexArrays(1, &vao);
-    glGenBuffers(1, &vbo);
-    glGenBuffers(1, &ebo);
+    state.BindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexStream.id);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexStream.id);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
 
-    // Text VAO/VBO
+    // 2D VAO (text/sprites): pos.xy + tex.uv + color.rgba
     glGenVertexArrays(1, &textVao);
-    glGenBuffers(1, &textVbo);
+    state.BindVertexArray(textVao);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexStream.id);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexStream.id);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(4 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+
+    // Glyph VAO (text): pos.xy + tex.uv + layer + color.rgba
+    glGenVertexArrays(1, &glyphVao);
+    state.BindVertexArray(glyphVao);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexStream.id);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexStream.id);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 9 * sizeof(float), (void*)(5 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+
+    // Post pass VAO: fullscreen triangle from gl_VertexID, no attributes
+    glGenVertexArrays(1, &postVao);
+
+    state.BindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Window size at context creation until SetOutputSize says otherwise
+    if (outputWidth == 0 || outputHeight == 0) {
+        GLint viewport[4] = { 0, 0, 0, 0 };
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        outputWidth = viewport[2];
+        outputHeight = viewport[3];
+    }
+
+    // Internal resolution target (falls back to drawing straight to the output)
+    sceneTarget = CreateRenderTarget(internalWidth, internalHeight);
+    CreateBloomTargets();
 
     // Set default projection (perspective)
     float aspect = 640.0f / 448.0f;
@@ -231,16 +928,30 @@ bool Renderer::Init() {
         printf("[Renderer] Warning: Font not loaded, text rendering disabled\n");
     }
 
+    BuildTextureAtlas();
+
+    CaptureRecordState();
+    profiler.Init();
+
     printf("[Renderer] Initialized successfully\n");
     return true;
 }
 
 void Renderer::Shutdown() {
+    // Nothing is queued any more: free deferred deletes, and let the ones below run directly
+    completedFrame = frameCounter.load();
+    FlushDeferredDeletes();
+    profiler.Shutdown();
     if (vao) { glDeleteVertexArrays(1, &vao); vao = 0; }
-    if (vbo) { glDeleteBuffers(1, &vbo); vbo = 0; }
-    if (ebo) { glDeleteBuffers(1, &ebo); ebo = 0; }
     if (textVao) { glDeleteVertexArrays(1, &textVao); textVao = 0; }
-    if (textVbo) { glDeleteBuffers(1, &textVbo); textVbo = 0; }
+    if (glyphVao) { glDeleteVertexArrays(1, &glyphVao); glyphVao = 0; }
+    if (postVao) { glDeleteVertexArrays(1, &postVao); postVao = 0; }
+    DeleteRenderTarget(sceneTarget);
+    DeleteBloomTargets();
+    vertexStream.Destroy();
+    indexStream.Destroy();
+    uploadStream.Destroy();
+    if (frameUbo) { glDeleteBuffers(1, &frameUbo); frameUbo = 0; }
     
     if (basicShader.valid) {
         glDeleteProgram(basicShader.id);
@@ -254,18 +965,77 @@ void Renderer::Shutdown() {
         glDeleteProgram(spriteShader.id);
         spriteShader.valid = false;
     }
+    if (gsSpriteShader.valid) {
+        glDeleteProgram(gsSpriteShader.id);
+        gsSpriteShader.valid = false;
+    }
+    if (instancedShader.valid) {
+        glDeleteProgram(instancedShader.id);
+        instancedShader.valid = false;
+    }
+    if (postFxShader.valid) {
+        glDeleteProgram(postFxShader.id);
+        postFxShader.valid = false;
+    }
+    if (bloomDownShader.valid) {
+        glDeleteProgram(bloomDownShader.id);
+        bloomDownShader.valid = false;
+    }
+    if (bloomUpShader.valid) {
+        glDeleteProgram(bloomUpShader.id);
+        bloomUpShader.valid = false;
+    }
     
-    if (fontTexture.valid) {
-        DeleteTexture(fontTexture);
+    if (glyphArray) {
+        state.ForgetTexture(glyphArray);
+        glDeleteTextures(1, &glyphArray);
+        glyphArray = 0;
+        glyphArrayBytes = 0;
     }
     
-    // Clean up texture cache
+    // Clean up mesh cache and instancing geometry
+    for (auto& pair : meshCache) {
+        DeleteMesh(pair.second);
+    }
+    meshCache.clear();
+    for (auto& pair : modelMeshes) {
+        DeleteMesh(pair.second.mesh);
+    }
+    modelMeshes.clear();
+    for (auto& pair : unitSpheres) {
+        DeleteMesh(pair.second);
+    }
+    unitSpheres.clear();
+    DeleteMesh(unitCube);
+    
+    // Clean up texture cache (atlas entries are owned by their page)
+    if (!textureCache.empty()) {
+        TextureCacheStats cacheStats = GetTextureCacheStats();
+        printf("[Renderer] Texture cache: %d entries, %llu hits, %llu misses, %llu evictions, %zu KB resident\n",
+               cacheStats.entries, (unsigned long long)cacheStats.hits, (unsigned long long)cacheStats.misses,
+               (unsigned long long)cacheStats.evictions, cacheStats.residentBytes / 1024);
+    }
     for (auto& pair : textureCache) {
-        if (pair.second.valid) {
-            glDeleteTextures(1, &pair.second.id);
+        const Texture& tex = pair.second.texture;
+        if (tex.valid && !tex.atlased) {
+            glDeleteTextures(1, &tex.id);
         }
     }
     textureCache.clear();
+    textureCacheBytes = 0;
+    if (!atlasPages.empty()) {
+        glDeleteTextures((GLsizei)atlasPages.size(), atlasPages.data());
+        atlasPages.clear();
+    }
+    textureAtlas.Clear();
+
+    for (auto& pair : texturePool) {
+        if (!pair.second.empty()) {
+            glDeleteTextures((GLsizei)pair.second.size(), pair.second.data());
+        }
+    }
+    texturePool.clear();
+    texturePoolBytes = 0;
 }
 
 bool Renderer::LoadFont() {
@@ -277,632 +1047,2197 @@ bool Renderer::LoadFont() {
         return false;
     }
 
-    // Mantemos compatibilidade carregando a textura MAIN (ASCII) na GPU para o sistema legado
-    int atlasWidth = fontLoader.GetAtlasWidth();
-    int atlasHeight = fontLoader.GetAtlasHeight();
-    const auto& rawData = fontLoader.GetTextureData();
-    
-    if (rawData.empty()) return false;
+    // Todos os bancos bitmap numa textura array R8 (alpha via swizzle)
+    if (!fontLoader.BuildGlyphTable(glyphTable)) return false;
 
-    printf("[Renderer] Creating MAIN font texture %dx%d...\n", atlasWidth, atlasHeight);
-    
-    fontTexture = CreateTexture(
-        rawData.data(),
-        atlasWidth,
-        atlasHeight,
-        4
-    );
+    printf("[Renderer] Creating glyph array %dx%d x %d layers...\n",
+           glyphTable.layerWidth, glyphTable.layerHeight, glyphTable.layers);
 
-    if (!fontTexture.valid) return false;
+    glGenTextures(1, &glyphArray);
+    renderStats.texturesCreated++;
+    state.BindTextureArray(0, glyphArray);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_R8, glyphTable.layerWidth, glyphTable.layerHeight,
+                 glyphTable.layers, 0, GL_RED, GL_UNSIGNED_BYTE, glyphTable.pixels.data());
+    renderStats.textureUploadBytes += glyphTable.pixels.size();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    const GLint swizzleMask[] = { GL_ONE, GL_ONE, GL_ONE, GL_RED };
+    glTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glyphArrayBytes = glyphTable.pixels.size();
+    // Os pixels já estão na GPU; só as UVs e o índice ficam na CPU
+    glyphTable.pixels.clear();
+    glyphTable.pixels.shrink_to_fit();
 
     fontLoaded = true;
     return true;
 }
 
 void Renderer::BeginFrame() {
+    // Anything outside the renderer may have touched GL since last frame
+    state.Invalidate();
+    if (!renderThread || !renderThread->IsRunning()) {
+        replayFrame = ++frameCounter;       // Drawing directly: no list carries the number
+    }
+    state.issued = 0;
+    state.elided = 0;
+    state.textureBinds = 0;
+    state.programSwitches = 0;
+    renderStats.ResetDraws();
+
+    if (sceneTarget.valid) {
+        BindTarget(&sceneTarget, internalWidth, internalHeight);
+    } else {
+        BindTarget(outputTarget, outputWidth, outputHeight);
+    }
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    profiler.BeginFrame();
+    currentPass = nullptr;
 }
 
 void Renderer::EndFrame() {
+    FlushQuads();
+    EnterPass(nullptr);
+
+    // Overlays are drawn outside any pass so they do not skew the numbers
+    if (profilerOverlay || statsOverlay) {
+        drawingOverlay = true;
+        if (profilerOverlay) DrawProfilerOverlay();
+        if (statsOverlay) DrawStatsOverlay(lastRenderStats);
+        FlushQuads();
+        drawingOverlay = false;
+    }
+
+    ResolveFrame();
+    profiler.EndFrame();
+
+    completedFrame = replayFrame;
+    FlushDeferredDeletes();
+
+    renderStats.textureBinds = state.textureBinds;
+    renderStats.programSwitches = state.programSwitches;
+    renderStats.stateCallsIssued = state.issued;
+    renderStats.stateCallsElided = state.elided;
+    {
+        std::lock_guard<std::mutex> lock(renderStatsMutex);
+        lastRenderStats = renderStats;
+    }
+    renderStats = RenderStats();
 }
 
 // ============================================================================
 // Camera/View
 // ============================================================================
 void Renderer::SetCamera(const Vec3& position, const Vec3& target, const Vec3& up) {
+    if (recordTarget) {
+        recordState.cameraPosition = position;
+        SetLookAtMatrix(recordState.view, position, target, up);
+        recordStateDirty = true;
+        return;
+    }
     cameraPosition = position;
     SetLookAtMatrix(viewMatrix, position, target, up);
+    frameUniformsDirty = true;
+    frustumDirty = true;
 }
 
 void Renderer::SetProjection(float fov, float aspect, float nearPlane, float farPlane) {
+    if (recordTarget) {
+        SetPerspectiveMatrix(recordState.projection, fov, aspect, nearPlane, farPlane);
+        recordStateDirty = true;
+        return;
+    }
     SetPerspectiveMatrix(projectionMatrix, fov, aspect, nearPlane, farPlane);
+    frameUniformsDirty = true;
+    frustumDirty = true;
 }
 
 void Renderer::SetOrtho(float left, float right, float bottom, float top, float nearPlane, float farPlane) {
+    if (recordTarget) {
+        SetOrthoMatrix(recordState.projection, left, right, bottom, top, nearPlane, farPlane);
+        recordStateDirty = true;
+        return;
+    }
     SetOrthoMatrix(projectionMatrix, left, right, bottom, top, nearPlane, farPlane);
+    frameUniformsDirty = true;
+    frustumDirty = true;
+}
+
+void Renderer::SetProfileScope(const char* scope) {
+    if (recordTarget) {
+        recordTarget->profileScope = scope;
+        return;
+    }
+    FlushQuads();
+    EnterPass(nullptr);
+    profiler.SetScope(scope);
+}
+
+void Renderer::SetTime(float seconds) {
+    if (recordTarget) {
+        recordTarget->time = seconds;
+        return;
+    }
+    frameTime = seconds;
+    frameUniformsDirty = true;
+}
+
+void Renderer::UpdateFrameUniforms() {
+    if (!frameUniformsDirty || !frameUbo) {
+        return;
+    }
+
+    FrameUniforms data;
+    memcpy(data.projection, projectionMatrix, sizeof(data.projection));
+    memcpy(data.view, viewMatrix, sizeof(data.view));
+    memcpy(data.ortho, orthoMatrix, sizeof(data.ortho));
+    data.fogColor[0] = fogColor.x;
+    data.fogColor[1] = fogColor.y;
+    data.fogColor[2] = fogColor.z;
+    data.fogDensity = fogDensity;
+    data.viewPos[0] = cameraPosition.x;
+    data.viewPos[1] = cameraPosition.y;
+    data.viewPos[2] = cameraPosition.z;
+    data.time = frameTime;
+
+    glBindBuffer(GL_UNIFORM_BUFFER, frameUbo);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameUniforms), &data);
+    renderStats.bufferUploadBytes += sizeof(FrameUniforms);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    frameUniformsDirty = false;
 }
 
 // ============================================================================
 // Fog Control
 // ============================================================================
 void Renderer::SetFog(float density, const Vec3& color) {
+    if (recordTarget) {
+        recordState.fogEnabled = true;
+        recordState.fogDensity = density;
+        recordState.fogColor = color;
+        recordStateDirty = true;
+        return;
+    }
     fogEnabled = true;
     fogDensity = density;
     fogColor = color;
+    frameUniformsDirty = true;
 }
 
 void Renderer::DisableFog() {
+    if (recordTarget) {
+        recordState.fogEnabled = false;
+        recordStateDirty = true;
+        return;
+    }
     fogEnabled = false;
 }
 
+void Renderer::SetFogCulling(bool enabled, float threshold) {
+    float value = enabled ? Math::Clamp(threshold, 0.0f, 1.0f) : 0.0f;
+    if (recordTarget) {
+        recordState.fogCullThreshold = value;
+        recordStateDirty = true;
+        return;
+    }
+    fogCullThreshold = value;
+}
+
+// ============================================================================
+// Culling
+// Draws are rejected on their world-space bounding sphere before any vertex
+// is packed or uploaded: outside one of the six frustum planes, or (opt-in)
+// so deep in the fog that even its nearest point fades to the fog color.
+// ============================================================================
+void Renderer::UpdateFrustum() {
+    // clip = projection * view (column-major)
+    float clip[16];
+    for (int c = 0; c < 4; c++) {
+        for (int r = 0; r < 4; r++) {
+            clip[c * 4 + r] = projectionMatrix[0 * 4 + r] * viewMatrix[c * 4 + 0] +
+                              projectionMatrix[1 * 4 + r] * viewMatrix[c * 4 + 1] +
+                              projectionMatrix[2 * 4 + r] * viewMatrix[c * 4 + 2] +
+                              projectionMatrix[3 * 4 + r] * viewMatrix[c * 4 + 3];
+        }
+    }
+
+    // Gribb/Hartmann: row 3 +/- row 0 (left/right), 1 (bottom/top), 2 (near/far)
+    for (int i = 0; i < 6; i++) {
+        int axis = i / 2;
+        float sign = (i & 1) ? -1.0f : 1.0f;
+        float* plane = frustumPlanes[i];
+        for (int c = 0; c < 4; c++) {
+            plane[c] = clip[c * 4 + 3] + sign * clip[c * 4 + axis];
+        }
+        float length = sqrtf(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        if (length > 0.0f) {
+            for (int c = 0; c < 4; c++) plane[c] /= length;
+        }
+    }
+    frustumDirty = false;
+}
+
+bool Renderer::IsSphereVisible(const Vec3& center, float radius) {
+    if (frustumDirty) {
+        UpdateFrustum();
+    }
+    for (const float* plane : frustumPlanes) {
+        if (plane[0] * center.x + plane[1] * center.y + plane[2] * center.z + plane[3] < -radius) {
+            return false;
+        }
+    }
+
+    if (fogEnabled && fogCullThreshold > 0.0f && fogDensity > 0.0f) {
+        float fogDistance = -logf(fogCullThreshold) / fogDensity;
+        if ((center - cameraPosition).Length() - radius > fogDistance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Renderer::IsMeshVisible(const float* model, const Vec3& scale, const Vec3& center, float radius) {
+    if (radius <= 0.0f) return true;    // No bounds
+
+    Vec3 world(model[0] * center.x + model[4] * center.y + model[8] * center.z + model[12],
+               model[1] * center.x + model[5] * center.y + model[9] * center.z + model[13],
+               model[2] * center.x + model[6] * center.y + model[10] * center.z + model[14]);
+    float maxScale = std::max(fabsf(scale.x), std::max(fabsf(scale.y), fabsf(scale.z)));
+    return IsSphereVisible(world, radius * maxScale);
+}
+
 // ============================================================================
 // 3D Drawing
 // ============================================================================
 void Renderer::DrawCube(const Vec3& position, const Vec3& scale, const Color& color, const Vec3& rotation) {
-    float vertices[] = {
-        -1.0f, -1.0f, -1.0f,   color.r, color.g, color.b, color.a,
-         1.0f, -1.0f, -1.0f,   color.r, color.g, color.b, color.a,
-         1.0f,  1.0f, -1.0f,   color.r, color.g, color.b, color.a,
-        -1.0f,  1.0f, -1.0f,   color.r, color.g, color.b, color.a,
-        -1.0f, -1.0f,  1.0f,   color.r, color.g, color.b, color.a,
-         1.0f, -1.0f,  1.0f,   color.r, color.g, color.b, color.a,
-         1.0f,  1.0f,  1.0f,   color.r, color.g, color.b, color.a,
-        -1.0f,  1.0f,  1.0f,   color.r, color.g, color.b, color.a,
-    };
-    
-    unsigned int indices[] = {
-        0, 1, 2,  2, 3, 0,
-        1, 5, 6,  6, 2, 1,
-        5, 4, 7,  7, 6, 5,
-        4, 0, 3,  3, 7, 4,
-        3, 2, 6,  6, 7, 3,
-        4, 5, 1,  1, 0, 4
-    };
-    
-    float cosX = cosf(rotation.x), sinX = sinf(rotation.x);
-    float cosY = cosf(rotation.y), sinY = sinf(rotation.y);
-    float cosZ = cosf(rotation.z), sinZ = sinf(rotation.z);
-    
-    for (int i = 0; i < 8; i++) {
-        float x = vertices[i*7 + 0] * scale.x;
-        float y = vertices[i*7 + 1] * scale.y;
-        float z = vertices[i*7 + 2] * scale.z;
-        
-        float xr = x * cosY + z * sinY;
-        float zr = -x * sinY + z * cosY;
-        x = xr; z = zr;
-        
-        float yr = y * cosX - z * sinX;
-        zr = y * sinX + z * cosX;
-        y = yr; z = zr;
-        
-        xr = x * cosZ - y * sinZ;
-        yr = x * sinZ + y * cosZ;
-        x = xr; y = yr;
-        
-        vertices[i*7 + 0] = x + position.x;
-        vertices[i*7 + 1] = y + position.y;
-        vertices[i*7 + 2] = z + position.z;
+    if (recordTarget) {
+        CubeArgs args = { position, scale, rotation, color };
+        Record3D(DrawOp::Cube, BeginPacket(&args, sizeof(args)), position, color.a);
+        return;
     }
-    
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-    
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_DYNAMIC_DRAW);
-    
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    
-    basicShader.Use();
-    basicShader.SetMat4("uProjection", projectionMatrix);
-    basicShader.SetMat4("uView", viewMatrix);
-    basicShader.SetBool("fogEnabled", fogEnabled);
-    basicShader.SetFloat("fogDensity", fogDensity);
-    basicShader.SetVec3("fogColor", fogColor);
-    basicShader.SetVec3("viewPos", cameraPosition);
-    
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    // Corners of the +-1 cube are |scale| from the center whatever the rotation,
+    // tighter than the unit cube's bounding sphere once the scale is uneven
+    if (!IsSphereVisible(position, scale.Length())) {
+        renderStats.culledDraws++;
+        return;
+    }
+    float model[16];
+    SetModelMatrix(model, position, scale, rotation);
+    DrawMeshUnculled(GetUnitCube(), model, color);
 }
 
+// Drawn from a resident upload (see GetModelMesh), the same way in both paths
 void Renderer::DrawMesh(const ICOBModel& mesh, const Vec3& position, const Vec3& scale, const Color& color, const Vec3& rotation) {
-    if (mesh.vertices.empty() || mesh.indices.empty()) {
+    DrawMesh(GetModelMesh(mesh), position, scale, color, rotation);
+}
+
+void Renderer::DrawMesh(const GpuMesh& mesh, const Vec3& position, const Vec3& scale, const Color& color, const Vec3& rotation) {
+    if (recordTarget) {
+        GpuMeshArgs args = { mesh, position, scale, rotation, color };
+        Record3D(DrawOp::GpuMesh, BeginPacket(&args, sizeof(args)), position, color.a);
+        return;
+    }
+    if (!mesh.valid) {
         return;
     }
 
-    std::vector<float> vertices;
-    vertices.reserve(mesh.vertices.size() * 7);
-    
-    float cosX = cosf(rotation.x), sinX = sinf(rotation.x);
-    float cosY = cosf(rotation.y), sinY = sinf(rotation.y);
-    float cosZ = cosf(rotation.z), sinZ = sinf(rotation.z);
-    
-    for (const auto& v : mesh.vertices) {
-        float x = v.position.x * scale.x;
-        float y = v.position.y * scale.y;
-        float z = v.position.z * scale.z;
-        
-        float xr = x * cosY + z * sinY;
-        float zr = -x * sinY + z * cosY;
-        x = xr; z = zr;
-        
-        float yr = y * cosX - z * sinX;
-        zr = y * sinX + z * cosX;
-        y = yr; z = zr;
-        
-        xr = x * cosZ - y * sinZ;
-        yr = x * sinZ + y * cosZ;
-        x = xr; y = yr;
-        
-        vertices.push_back(x + position.x);
-        vertices.push_back(y + position.y);
-        vertices.push_back(z + position.z);
-        vertices.push_back(v.color.r * color.r);
-        vertices.push_back(v.color.g * color.g);
-        vertices.push_back(v.color.b * color.b);
-        vertices.push_back(v.color.a * color.a);
+    float model[16];
+    SetModelMatrix(model, position, scale, rotation);
+    if (!IsMeshVisible(model, scale, mesh.boundsCenter, mesh.boundsRadius)) {
+        renderStats.culledDraws++;
+        return;
     }
-    
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
-    
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(uint16_t), mesh.indices.data(), GL_DYNAMIC_DRAW);
-    
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    
-    basicShader.Use();
-    basicShader.SetMat4("uProjection", projectionMatrix);
-    basicShader.SetMat4("uView", viewMatrix);
-    basicShader.SetBool("fogEnabled", fogEnabled);
-    basicShader.SetFloat("fogDensity", fogDensity);
-    basicShader.SetVec3("fogColor", fogColor);
-    basicShader.SetVec3("viewPos", cameraPosition);
-    
-    glDrawElements(GL_TRIANGLES, (GLsizei)mesh.indices.size(), GL_UNSIGNED_SHORT, 0);
+    DrawMeshUnculled(mesh, model, color);
+}
+
+// Public entry points cull (once) before calling this
+void Renderer::DrawMeshUnculled(const GpuMesh& mesh, const float* model, const Color& color) {
+    if (!mesh.valid) return;
+    FlushQuads();
+
+    state.BindVertexArray(mesh.vao);
+    UseBasicShader(model, color, fogEnabled);
+
+    glDrawElements(GL_TRIANGLES, mesh.indexCount, mesh.indexType, 0);
+    CountDraw(GL_TRIANGLES, mesh.vertexCount, mesh.indexCount);
 }
 
 void Renderer::DrawSphere(const Vec3& position, float radius, const Color& color, int segments) {
-    std::vector<float> vertices;
-    std::vector<uint32_t> indices;
-    
-    CreateSphereGeometry(vertices, indices, radius, segments);
-    
-    for (size_t i = 0; i < vertices.size(); i += 7) {
-        vertices[i + 0] += position.x;
-        vertices[i + 1] += position.y;
-        vertices[i + 2] += position.z;
-        vertices[i + 3] = color.r;
-        vertices[i + 4] = color.g;
-        vertices[i + 5] = color.b;
-        vertices[i + 6] = color.a;
+    if (recordTarget) {
+        SphereArgs args = { position, radius, color, segments };
+        Record3D(DrawOp::Sphere, BeginPacket(&args, sizeof(args)), position, color.a);
+        return;
     }
-    
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
-    
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_DYNAMIC_DRAW);
-    
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    
-    basicShader.Use();
-    basicShader.SetMat4("uProjection", projectionMatrix);
-    basicShader.SetMat4("uView", viewMatrix);
-    basicShader.SetBool("fogEnabled", fogEnabled);
-    basicShader.SetFloat("fogDensity", fogDensity);
-    basicShader.SetVec3("fogColor", fogColor);
-    basicShader.SetVec3("viewPos", cameraPosition);
-    
-    glDrawElements(GL_TRIANGLES, (GLsizei)indices.size(), GL_UNSIGNED_INT, 0);
+    if (!IsSphereVisible(position, fabsf(radius))) {
+        renderStats.culledDraws++;
+        return;
+    }
+    int lod = SelectSphereLod(position, radius, segments);
+    float model[16];
+    SetModelMatrix(model, position, Vec3(radius), Vec3(0.0f));
+    DrawMeshUnculled(GetUnitSphere(lod), model, color);
+}
+
+// ============================================================================
+// Instanced 3D Drawing
+// ============================================================================
+void Renderer::DrawCubesInstanced(const InstanceData* instances, size_t count) {
+    if (count == 0) return;
+    if (recordTarget) {
+        RecordInstances(DrawOp::CubesInstanced, instances, count, 0);
+        return;
+    }
+
+    if (!instancedShader.valid) {
+        for (size_t i = 0; i < count; i++) {
+            DrawCube(instances[i].position, instances[i].scale, instances[i].color, instances[i].rotation);
+        }
+        return;
+    }
+    DrawInstanced(GetUnitCube(), instances, count, true);
+}
+
+void Renderer::DrawSpheresInstanced(const InstanceData* instances, size_t count, int segments) {
+    if (count == 0) return;
+    if (recordTarget) {
+        RecordInstances(DrawOp::SpheresInstanced, instances, count, segments);
+        return;
+    }
+
+    // Cull first so off-screen spheres cannot raise the batch LOD
+    sphereScratch.clear();
+    for (size_t i = 0; i < count; i++) {
+        const InstanceData& inst = instances[i];
+        if (!IsSphereVisible(inst.position, fabsf(inst.scale.x))) {
+            renderStats.culledInstances++;
+            continue;
+        }
+        sphereScratch.push_back(inst);
+        sphereScratch.back().scale = Vec3(inst.scale.x);
+    }
+    if (sphereScratch.empty()) return;
+
+    // One mesh for the whole batch: LOD follows the largest on-screen instance
+    int lod = SPHERE_LOD_LEVELS[0];
+    for (size_t i = 0; i < sphereScratch.size() && lod < SPHERE_LOD_LEVELS[SPHERE_LOD_COUNT - 1]; i++) {
+        lod = std::max(lod, SelectSphereLod(sphereScratch[i].position, sphereScratch[i].scale.x, segments));
+    }
+    segments = lod;
+
+    if (!instancedShader.valid) {
+        GpuMesh& sphere = GetUnitSphere(segments);
+        float model[16];
+        for (const InstanceData& inst : sphereScratch) {
+            SetModelMatrix(model, inst.position, inst.scale, inst.rotation);
+            DrawMeshUnculled(sphere, model, inst.color);
+        }
+        return;
+    }
+    DrawInstanced(GetUnitSphere(segments), sphereScratch.data(), sphereScratch.size(), false);
+}
+
+void Renderer::DrawInstanced(GpuMesh& mesh, const InstanceData* instances, size_t count, bool cull) {
+    if (!mesh.valid) return;
+    FlushQuads();
+
+    const size_t stride = INSTANCE_FLOATS * sizeof(float);
+
+    // Lazily build the instanced VAO: static attributes from the mesh,
+    // instance attributes re-pointed into the vertex stream every draw
+    if (mesh.instanceVao == 0) {
+        glGenVertexArrays(1, &mesh.instanceVao);
+        state.BindVertexArray(mesh.instanceVao);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.ibo);
+
+        for (int i = 2; i <= 6; i++) {
+            glEnableVertexAttribArray(i);
+            glVertexAttribDivisor(i, 1);
+        }
+    }
+
+    UpdateFrameUniforms();
+    Apply3DState();
+    state.UseProgram(instancedShader.id);
+    instancedShader.SetBool("fogEnabled", fogEnabled);
+
+    state.BindVertexArray(mesh.instanceVao);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexStream.id);
+
+    // A single push may not exceed one ring segment, so split large batches
+    const size_t maxPerPush = (vertexStream.size / StreamBuffer::SEGMENT_COUNT) / stride;
+
+    for (size_t first = 0; first < count; first += maxPerPush) {
+        size_t batch = std::min(count - first, maxPerPush);
+
+        // Culled instances are dropped while packing (unless the caller already culled)
+        instanceScratch.resize(batch * INSTANCE_FLOATS);
+        size_t visible = 0;
+        for (size_t i = 0; i < batch; i++) {
+            const InstanceData& inst = instances[first + i];
+            float* dst = &instanceScratch[visible * INSTANCE_FLOATS];
+            SetModelMatrix(dst, inst.position, inst.scale, inst.rotation);
+            if (cull && !IsMeshVisible(dst, inst.scale, mesh.boundsCenter, mesh.boundsRadius)) {
+                renderStats.culledInstances++;
+                continue;
+            }
+            dst[16] = inst.color.r;
+            dst[17] = inst.color.g;
+            dst[18] = inst.color.b;
+            dst[19] = inst.color.a;
+            visible++;
+        }
+        if (visible == 0) continue;
+
+        size_t offset = vertexStream.Push(instanceScratch.data(), visible * stride, stride);
+        if (offset == SIZE_MAX) {
+            printf("[Renderer] Instance stream push failed (%zu instances)\n", visible);
+            break;
+        }
+
+        for (int col = 0; col < 4; col++) {
+            glVertexAttribPointer(2 + col, 4, GL_FLOAT, GL_FALSE, (GLsizei)stride,
+                                  (void*)(offset + col * 4 * sizeof(float)));
+        }
+        glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, (GLsizei)stride,
+                              (void*)(offset + 16 * sizeof(float)));
+
+        glDrawElementsInstanced(GL_TRIANGLES, mesh.indexCount, mesh.indexType, 0, (GLsizei)visible);
+        CountDraw(GL_TRIANGLES, mesh.vertexCount, mesh.indexCount, visible);
+    }
+}
+
+GpuMesh& Renderer::GetUnitCube() {
+    if (!unitCube.valid) {
+        static const float vertices[] = {
+            -1.0f, -1.0f, -1.0f,   1.0f, 1.0f, 1.0f, 1.0f,
+             1.0f, -1.0f, -1.0f,   1.0f, 1.0f, 1.0f, 1.0f,
+             1.0f,  1.0f, -1.0f,   1.0f, 1.0f, 1.0f, 1.0f,
+            -1.0f,  1.0f, -1.0f,   1.0f, 1.0f, 1.0f, 1.0f,
+            -1.0f, -1.0f,  1.0f,   1.0f, 1.0f, 1.0f, 1.0f,
+             1.0f, -1.0f,  1.0f,   1.0f, 1.0f, 1.0f, 1.0f,
+             1.0f,  1.0f,  1.0f,   1.0f, 1.0f, 1.0f, 1.0f,
+            -1.0f,  1.0f,  1.0f,   1.0f, 1.0f, 1.0f, 1.0f,
+        };
+        static const uint32_t indices[] = {
+            0, 1, 2,  2, 3, 0,
+            1, 5, 6,  6, 2, 1,
+            5, 4, 7,  7, 6, 5,
+            4, 0, 3,  3, 7, 4,
+            3, 2, 6,  6, 7, 3,
+            4, 5, 1,  1, 0, 4
+        };
+        unitCube = CreateStaticMesh(vertices, 8, indices, sizeof(indices), GL_UNSIGNED_INT, 36);
+    }
+    return unitCube;
+}
+
+int Renderer::SelectSphereLod(const Vec3& center, float radius, int maxSegments) const {
+    // Explicit segment counts act as a cap, snapped down to a cached level
+    int cap = SPHERE_LOD_LEVELS[SPHERE_LOD_COUNT - 1];
+    if (maxSegments > 0) {
+        cap = SPHERE_LOD_LEVELS[0];
+        for (int i = 0; i < SPHERE_LOD_COUNT; i++) {
+            if (SPHERE_LOD_LEVELS[i] <= maxSegments) cap = SPHERE_LOD_LEVELS[i];
+        }
+    }
+
+    float distance = (center - cameraPosition).Length();
+    if (distance <= radius) {
+        return cap;
+    }
+
+    // Projected radius in PS2 scanlines (projectionMatrix[5] = 1 / tan(fov / 2))
+    float screenRadius = radius / distance * projectionMatrix[5] * (SPHERE_LOD_SCREEN_HEIGHT * 0.5f);
+
+    // Enough segments to keep silhouette edges around SPHERE_LOD_EDGE_PIXELS long
+    float wanted = 2.0f * Math::PI * screenRadius / SPHERE_LOD_EDGE_PIXELS;
+    for (int i = 0; i < SPHERE_LOD_COUNT; i++) {
+        if (SPHERE_LOD_LEVELS[i] >= cap || SPHERE_LOD_LEVELS[i] >= wanted) {
+            return std::min(SPHERE_LOD_LEVELS[i], cap);
+        }
+    }
+    return cap;
+}
+
+GpuMesh& Renderer::GetUnitSphere(int segments) {
+    GpuMesh& sphere = unitSpheres[segments];
+    if (!sphere.valid) {
+        std::vector<float> vertices;
+        std::vector<uint32_t> indices;
+        CreateSphereGeometry(vertices, indices, 1.0f, segments);
+        sphere = CreateStaticMesh(vertices.data(), vertices.size() / 7,
+                                  indices.data(), indices.size() * sizeof(uint32_t),
+                                  GL_UNSIGNED_INT, (int)indices.size());
+    }
+    return sphere;
 }
 
 // ============================================================================
 // 2D Drawing
 // ============================================================================
 void Renderer::DrawLine(const Vec3& start, const Vec3& end, const Color& color, float width) {
+    if (recordTarget) {
+        LineArgs args = { start, end, color, width };
+        Record3D(DrawOp::Line, BeginPacket(&args, sizeof(args)), (start + end) * 0.5f, color.a);
+        return;
+    }
+    FlushQuads();
+
     float vertices[] = {
         start.x, start.y, start.z, color.r, color.g, color.b, color.a,
         end.x, end.y, end.z, color.r, color.g, color.b, color.a
     };
     
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-    
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+    int baseVertex = PushVertices(vertices, 2, 7 * sizeof(float));
+    if (baseVertex < 0) return;
     
-    basicShader.Use();
-    basicShader.SetMat4("uProjection", projectionMatrix);
-    basicShader.SetMat4("uView", viewMatrix);
-    basicShader.SetBool("fogEnabled", false);
+    state.BindVertexArray(vao);
+    UseBasicShader(IDENTITY_MATRIX, Color(1.0f, 1.0f, 1.0f, 1.0f), false);
     
-    glLineWidth(width);
-    glDrawArrays(GL_LINES, 0, 2);
-    glLineWidth(1.0f);
+    state.SetLineWidth(width);
+    glDrawArrays(GL_LINES, baseVertex, 2);
+    CountDraw(GL_LINES, 2, 0);
 }
 
 void Renderer::DrawRect(float x, float y, float w, float h, const Color& color) {
+    if (recordTarget) {
+        RectArgs args = { x, y, w, h, color };
+        recordTarget->Add2D(DrawOp::Rect, BeginPacket(&args, sizeof(args)));
+        return;
+    }
+    if (!spriteShader.valid) {
+        DrawRectBasic(x, y, w, h, color);
+        return;
+    }
+
+    // Untextured quad through the sprite shader so it batches with other 2D
     float vertices[] = {
-        x, y, 0, color.r, color.g, color.b, color.a,
-        x + w, y, 0, color.r, color.g, color.b, color.a,
-        x + w, y + h, 0, color.r, color.g, color.b, color.a,
-        x, y + h, 0, color.r, color.g, color.b, color.a
+        x,     y + h,  0.0f, 0.0f,  color.r, color.g, color.b, color.a,
+        x + w, y + h,  0.0f, 0.0f,  color.r, color.g, color.b, color.a,
+        x + w, y,      0.0f, 0.0f,  color.r, color.g, color.b, color.a,
+        x + w, y,      0.0f, 0.0f,  color.r, color.g, color.b, color.a,
+        x,     y,      0.0f, 0.0f,  color.r, color.g, color.b, color.a,
+        x,     y + h,  0.0f, 0.0f,  color.r, color.g, color.b, color.a
+    };
+    PushQuad(spriteShader, 0, additiveBlend, vertices);
+}
+
+// Sprite shader failed to build: one unbatched draw through the basic shader,
+// with the ortho matrix swapped into the frame uniforms for its duration
+void Renderer::DrawRectBasic(float x, float y, float w, float h, const Color& color) {
+    FlushQuads();
+
+    float vertices[] = {
+        x,     y,      0.0f,  color.r, color.g, color.b, color.a,
+        x + w, y,      0.0f,  color.r, color.g, color.b, color.a,
+        x + w, y + h,  0.0f,  color.r, color.g, color.b, color.a,
+        x,     y + h,  0.0f,  color.r, color.g, color.b, color.a
     };
-    
     unsigned int indices[] = { 0, 1, 2, 2, 3, 0 };
-    
-    glDisable(GL_DEPTH_TEST);
-    
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_DYNAMIC_DRAW);
-    
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    
-    basicShader.Use();
-    basicShader.SetMat4("uProjection", orthoMatrix);
-    
-    float identityView[16];
-    SetIdentityMatrix(identityView);
-    basicShader.SetMat4("uView", identityView);
+
+    int baseVertex = PushVertices(vertices, 4, 7 * sizeof(float));
+    size_t indexOffset = PushIndices(indices, sizeof(indices));
+    if (baseVertex < 0 || indexOffset == SIZE_MAX) return;
+
+    float savedProjection[16], savedView[16];
+    memcpy(savedProjection, projectionMatrix, sizeof(savedProjection));
+    memcpy(savedView, viewMatrix, sizeof(savedView));
+    memcpy(projectionMatrix, orthoMatrix, sizeof(projectionMatrix));
+    SetIdentityMatrix(viewMatrix);
+    frameUniformsDirty = true;
+
+    EnterPass("Sprites");
+    state.SetDepthTest(false);
+    state.SetBlend(true);
+    state.SetBlendFunc(GL_SRC_ALPHA, additiveBlend ? GL_ONE : GL_ONE_MINUS_SRC_ALPHA);
+    UpdateFrameUniforms();
+    state.BindVertexArray(vao);
+    state.UseProgram(basicShader.id);
+    basicShader.SetMat4("uModel", IDENTITY_MATRIX);
+    basicShader.SetVec4("uTint", 1.0f, 1.0f, 1.0f, 1.0f);
     basicShader.SetBool("fogEnabled", false);
-    
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-    
-    glEnable(GL_DEPTH_TEST);
+
+    glDrawElementsBaseVertex(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)indexOffset, baseVertex);
+    CountDraw(GL_TRIANGLES, 4, 6);
+
+    memcpy(projectionMatrix, savedProjection, sizeof(projectionMatrix));
+    memcpy(viewMatrix, savedView, sizeof(viewMatrix));
+    frameUniformsDirty = true;
 }
 
 void Renderer::DrawSprite(const Texture& tex, float x, float y, float w, float h, const Color& tint) {
+    if (recordTarget) {
+        SpriteArgs args = { tex, x, y, w, h, tint };
+        recordTarget->Add2D(DrawOp::Sprite, BeginPacket(&args, sizeof(args)));
+        return;
+    }
     if (!tex.valid || !spriteShader.valid) {
         // Fallback to colored rect
         DrawRect(x, y, w, h, tint);
         return;
     }
 
-    // Vertex data: pos.xy, tex.uv, color.rgba
+    // Vertex data: pos.xy, tex.uv (sub-rect for atlas entries), color.rgba
     float vertices[] = {
         // Bottom-left
-        x,     y + h,  0.0f, 1.0f,  tint.r, tint.g, tint.b, tint.a,
+        x,     y + h,  tex.u0, tex.v1,  tint.r, tint.g, tint.b, tint.a,
         // Bottom-right
-        x + w, y + h,  1.0f, 1.0f,  tint.r, tint.g, tint.b, tint.a,
+        x + w, y + h,  tex.u1, tex.v1,  tint.r, tint.g, tint.b, tint.a,
         // Top-right
-        x + w, y,      1.0f, 0.0f,  tint.r, tint.g, tint.b, tint.a,
+        x + w, y,      tex.u1, tex.v0,  tint.r, tint.g, tint.b, tint.a,
         // Top-right (dup)
-        x + w, y,      1.0f, 0.0f,  tint.r, tint.g, tint.b, tint.a,
+        x + w, y,      tex.u1, tex.v0,  tint.r, tint.g, tint.b, tint.a,
         // Top-left
-        x,     y,      0.0f, 0.0f,  tint.r, tint.g, tint.b, tint.a,
+        x,     y,      tex.u0, tex.v0,  tint.r, tint.g, tint.b, tint.a,
         // Bottom-left (dup)
-        x,     y + h,  0.0f, 1.0f,  tint.r, tint.g, tint.b, tint.a
+        x,     y + h,  tex.u0, tex.v1,  tint.r, tint.g, tint.b, tint.a
     };
 
-    glDisable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    glBindVertexArray(textVao);  // Reuse text VAO since same format
-    glBindBuffer(GL_ARRAY_BUFFER, textVbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
-
-    // Stride: 8 floats
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(2 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(4 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    spriteShader.Use();
-    spriteShader.SetMat4("uProjection", orthoMatrix);
-    spriteShader.SetBool("uUseTexture", true);
-    spriteShader.SetInt("uTexture", 0);
-
-    tex.Bind(0);
-    glDrawArrays(GL_TRIANGLES, 0, 6);
-    tex.Unbind();
-
-    glEnable(GL_DEPTH_TEST);
+    PushQuad(spriteShader, tex.id, false, vertices);
 }
 
 void Renderer::DrawSprite(const std::string& texName, float x, float y, float w, float h, const Color& tint) {
+    // Resolved now, so a recorded packet never touches the cache during replay
     Texture tex = GetCachedTexture(texName);
     DrawSprite(tex, x, y, w, h, tint);
 }
 
-void Renderer::DrawText(const char* text, float x, float y, const Color& color, float scale) {
-    if (!fontLoaded || !textShader.valid) {
-        // Fallback: draw placeholder rectangles
-        float charWidth = 8.0f * scale;
-        float charHeight = 16.0f * scale;
-        float spacing = 2.0f * scale;
-        float curX = x;
-        
-        while (*text) {
-            if (*text == ' ') {
-                curX += charWidth + spacing;
-                text++;
-                continue;
-            }
-            if (*text == '\n') {
-                curX = x;
-                y += charHeight + spacing;
-                text++;
-                continue;
+void Renderer::DrawSprite(const GsTexture& tex, float x, float y, float w, float h, const Color& tint) {
+    if (recordTarget) {
+        GsSpriteArgs args = { tex, x, y, w, h, tint };
+        recordTarget->Add2D(DrawOp::GsSprite, BeginPacket(&args, sizeof(args)));
+        return;
+    }
+    if (!tex.valid || !gsSpriteShader.valid) {
+        DrawRect(x, y, w, h, tint);
+        return;
+    }
+
+    float vertices[] = {
+        x,     y + h,  0.0f, 1.0f,  tint.r, tint.g, tint.b, tint.a,
+        x + w, y + h,  1.0f, 1.0f,  tint.r, tint.g, tint.b, tint.a,
+        x + w, y,      1.0f, 0.0f,  tint.r, tint.g, tint.b, tint.a,
+        x + w, y,      1.0f, 0.0f,  tint.r, tint.g, tint.b, tint.a,
+        x,     y,      0.0f, 0.0f,  tint.r, tint.g, tint.b, tint.a,
+        x,     y + h,  0.0f, 1.0f,  tint.r, tint.g, tint.b, tint.a
+    };
+
+    // Batches are keyed on the payload id, which is unique per GsTexture
+    PushQuad(gsSpriteShader, tex.id, false, vertices);
+    quadGsTexture = tex;
+}
+
+void Renderer::DrawText(const char* text, float x, float y, const Color& color, float scale) {
+    DrawTextBox(text, x, y, 0.0f, TextAlign::Left, color, scale);
+}
+
+void Renderer::DrawTextBox(const char* text, float x, float y, float width, TextAlign align,
+                           const Color& color, float scale) {
+    if (recordTarget) {
+        TextArgs args = { x, y, scale, width, align, color, (uint32_t)strlen(text) };
+        uint32_t offset = BeginPacket(&args, sizeof(args));
+        recordTarget->AppendData(text, args.length + 1);
+        recordTarget->Add2D(DrawOp::Text, offset);
+        return;
+    }
+    if (!fontLoaded || !textShader.valid) {
+        // Fallback: draw placeholder rectangles (no wrapping)
+        float charWidth = 8.0f * scale;
+        float charHeight = 16.0f * scale;
+        float spacing = 2.0f * scale;
+        float textWidth = GetTextWidth(text, scale);
+        float curX = x;
+        if (align == TextAlign::Center) curX += (width - textWidth) * 0.5f;
+        if (align == TextAlign::Right) curX += width - textWidth;
+        float lineX = curX;
+        
+        while (*text) {
+            uint32_t cp = TextCodec::NextUtf8(text);
+            if (cp == ' ') {
+                curX += charWidth + spacing;
+                continue;
+            }
+            if (cp == '\n') {
+                curX = lineX;
+                y += charHeight + spacing;
+                continue;
             }
             DrawRect(curX, y, charWidth, charHeight, color);
             curX += charWidth + spacing;
-            text++;
         }
         return;
     }
 
-    // Build vertex buffer for all characters
-    std::vector<float> vertices;
-    // Arredondar para pixels inteiros para alinhamento perfeito
-    float curX = floorf(x);
-    float curY = floorf(y);
-    float glyphH = FontLoader::GLYPH_HEIGHT * scale;
+    std::lock_guard<std::mutex> lock(textLayoutMutex);
+    PushTextQuads(GetCachedTextLayout(text, scale, width), x, y, width, align, color);
+}
+
+void Renderer::LayoutText(const char* text, float scale, float wrapWidth, TextLayout& out) {
+    out.vertices.clear();
+    out.lines.clear();
+
+    struct Run { uint32_t cp; const TableGlyph* glyph; float advance; };
+    std::vector<Run> runs;
+    while (*text) {
+        uint32_t cp = TextCodec::NextUtf8(text);
+        const TableGlyph& glyph = glyphTable.Find(cp);
+        runs.push_back({ cp, &glyph, floorf(glyph.advance * scale) });
+    }
+
+    // Greedy line breaking: after spaces and between CJK characters; a word
+    // wider than the box is broken at the glyph that overflows
+    std::vector<std::pair<size_t, size_t>> breaks;
+    size_t lineStart = 0;
+    size_t lastBreak = SIZE_MAX;
+    float lineWidth = 0.0f;
+    float widthAtBreak = 0.0f;
+    for (size_t i = 0; i < runs.size(); i++) {
+        const Run& run = runs[i];
+        if (run.cp == '\n') {
+            breaks.push_back({ lineStart, i });
+            lineStart = i + 1;
+            lineWidth = 0.0f;
+            lastBreak = SIZE_MAX;
+            continue;
+        }
+        // Loops at most twice: the rest of a word moved down may still not fit
+        while (wrapWidth > 0.0f && run.cp != ' ' && i > lineStart && lineWidth + run.advance > wrapWidth) {
+            if (lastBreak != SIZE_MAX) {
+                breaks.push_back({ lineStart, lastBreak });
+                lineStart = lastBreak;
+                lineWidth -= widthAtBreak;
+            } else {
+                breaks.push_back({ lineStart, i });
+                lineStart = i;
+                lineWidth = 0.0f;
+            }
+            lastBreak = SIZE_MAX;
+        }
+        lineWidth += run.advance;
+        if (run.cp == ' ' || run.cp >= 0x2E80) {
+            lastBreak = i + 1;
+            widthAtBreak = lineWidth;
+        }
+    }
+    breaks.push_back({ lineStart, runs.size() });
+
+    float glyphH = FontLoader::GLYPH_HEIGHT * scale;
+    float lineAdvance = glyphH + 2.0f * scale;
+    out.bounds = TextBounds();
+
+    for (size_t l = 0; l < breaks.size(); l++) {
+        TextLayout::Line line;
+        line.firstQuad = (uint32_t)(out.vertices.size() / GLYPH_QUAD_FLOATS);
+        line.width = 0.0f;
+
+        // Arredondar para pixels inteiros para alinhamento perfeito
+        float curX = 0.0f;
+        float y0 = floorf(l * lineAdvance);
+        float y1 = y0 + floorf(glyphH);
+
+        for (size_t i = breaks[l].first; i < breaks[l].second; i++) {
+            const Run& run = runs[i];
+            const TableGlyph& glyph = *run.glyph;
+
+            // Skip rendering for space and blank cells but advance cursor
+            if (run.cp == ' ' || glyph.width <= 0.0f) {
+                curX += run.advance;
+                continue;
+            }
+
+            float x0 = curX;
+            float x1 = curX + floorf(glyph.width * scale);
+
+            // Quad vertices: pos.x, pos.y, tex.u, tex.v, layer, color.r, g, b, a (color set on push)
+            const float g = glyph.layer;
+            const float quad[] = {
+                // Bottom-left
+                x0, y1,  glyph.u0, glyph.v1, g,  1.0f, 1.0f, 1.0f, 1.0f,
+                // Bottom-right
+                x1, y1,  glyph.u1, glyph.v1, g,  1.0f, 1.0f, 1.0f, 1.0f,
+                // Top-right
+                x1, y0,  glyph.u1, glyph.v0, g,  1.0f, 1.0f, 1.0f, 1.0f,
+                // Top-right (duplicate for second triangle)
+                x1, y0,  glyph.u1, glyph.v0, g,  1.0f, 1.0f, 1.0f, 1.0f,
+                // Top-left
+                x0, y0,  glyph.u0, glyph.v0, g,  1.0f, 1.0f, 1.0f, 1.0f,
+                // Bottom-left (duplicate for second triangle)
+                x0, y1,  glyph.u0, glyph.v1, g,  1.0f, 1.0f, 1.0f, 1.0f
+            };
+            out.vertices.insert(out.vertices.end(), quad, quad + GLYPH_QUAD_FLOATS);
+
+            curX += run.advance;
+            line.width = curX;      // Trailing spaces don't count
+        }
+
+        line.quadCount = (uint32_t)(out.vertices.size() / GLYPH_QUAD_FLOATS) - line.firstQuad;
+        out.lines.push_back(line);
+        out.bounds.width = std::max(out.bounds.width, line.width);
+    }
+
+    out.bounds.lines = (int)out.lines.size();
+    out.bounds.height = floorf((out.bounds.lines - 1) * lineAdvance + glyphH);
+}
+
+static uint64_t HashTextKey(const char* text, float scale, float wrapWidth) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (const char* p = text; *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 0x100000001B3ull;
+    }
+    const float params[] = { scale, wrapWidth };
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(params);
+    for (size_t i = 0; i < sizeof(params); i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+const TextLayout& Renderer::GetCachedTextLayout(const char* text, float scale, float wrapWidth) {
+    uint64_t hash = HashTextKey(text, scale, wrapWidth);
+    auto found = textLayoutIndex.find(hash);
+    if (found != textLayoutIndex.end()) {
+        CachedTextLayout& entry = *found->second;
+        if (entry.scale == scale && entry.wrapWidth == wrapWidth && entry.text == text) {
+            textLayouts.splice(textLayouts.begin(), textLayouts, found->second);
+            return entry.layout;
+        }
+        // Hash collision: the slot goes to the new string
+        textLayouts.erase(found->second);
+        textLayoutIndex.erase(found);
+    }
+
+    // Miss: recycle the least recently used entry's storage when full
+    if (textLayouts.size() >= TEXT_LAYOUT_CACHE_SIZE) {
+        textLayoutIndex.erase(textLayouts.back().hash);
+        textLayouts.splice(textLayouts.begin(), textLayouts, std::prev(textLayouts.end()));
+    } else {
+        textLayouts.emplace_front();
+    }
+
+    CachedTextLayout& entry = textLayouts.front();
+    entry.hash = hash;
+    entry.text = text;
+    entry.scale = scale;
+    entry.wrapWidth = wrapWidth;
+    LayoutText(text, scale, wrapWidth, entry.layout);
+    textLayoutIndex[hash] = textLayouts.begin();
+    return entry.layout;
+}
+
+// ============================================================================
+// Retained Text
+// ============================================================================
+void Renderer::SetTextMesh(TextMesh& mesh, const char* text, float x, float y, const Color& color, float scale) {
+    // Layouts sit at the origin, so moving or recoloring a mesh is free
+    mesh.color = color;
+    mesh.x = x;
+    mesh.y = y;
+    if (mesh.laidOut && mesh.scale == scale && mesh.text == text) {
+        return;
+    }
+    mesh.text = text;
+    mesh.scale = scale;
+
+    // Without the font DrawTextMesh falls back to DrawText placeholders
+    mesh.laidOut = fontLoaded;
+    if (fontLoaded) {
+        LayoutText(text, scale, 0.0f, mesh.layout);
+    } else {
+        mesh.layout = TextLayout();
+    }
+}
+
+void Renderer::DrawTextMesh(const TextMesh& mesh) {
+    // Recorded as plain text: the mesh may change before the list is replayed
+    if (recordTarget || !mesh.laidOut || !textShader.valid) {
+        DrawText(mesh.text.c_str(), mesh.x, mesh.y, mesh.color, mesh.scale);
+        return;
+    }
+    PushTextQuads(mesh.layout, mesh.x, mesh.y, 0.0f, TextAlign::Left, mesh.color);
+}
+
+TextBounds Renderer::MeasureText(const char* text, float scale, float wrapWidth) {
+    if (!fontLoaded || !textShader.valid) {
+        // Same metrics as the placeholder path in DrawTextBox: one 8+2 cell per
+        // codepoint, 16+2 per line
+        TextBounds bounds;
+        bounds.lines = 1;
+        int columns = 0;
+        while (*text) {
+            uint32_t cp = TextCodec::NextUtf8(text);
+            if (cp == '\n') {
+                bounds.lines++;
+                columns = 0;
+                continue;
+            }
+            columns++;
+            if (cp != ' ') bounds.width = std::max(bounds.width, columns * 10.0f * scale);
+        }
+        bounds.height = ((bounds.lines - 1) * 18.0f + 16.0f) * scale;
+        return bounds;
+    }
+    // Shares the draw cache: text measured to be centered is drawn from the same layout
+    std::lock_guard<std::mutex> lock(textLayoutMutex);
+    return GetCachedTextLayout(text, scale, wrapWidth).bounds;
+}
+
+float Renderer::GetTextWidth(const char* text, float scale) {
+    return MeasureText(text, scale).width;
+}
+
+// ============================================================================
+// Command Recording / Replay
+// ============================================================================
+void Renderer::BeginRecording(CommandList& list) {
+    list.Reset();
+    list.frame = ++frameCounter;
+    recordTarget = &list;
+    recordStateDirty = true;
+}
+
+void Renderer::EndRecording() {
+    recordTarget = nullptr;
+}
+
+uint32_t Renderer::BeginPacket(const void* args, size_t bytes) {
+    if (recordStateDirty) {
+        recordTarget->PushState(recordState);
+        recordStateDirty = false;
+    }
+    return recordTarget->PushData(args, bytes);
+}
+
+void Renderer::Record3D(DrawOp op, uint32_t dataOffset, const Vec3& position, float alpha) {
+    CommandList::Bucket bucket = CommandList::BUCKET_OPAQUE;
+    if (!recordState.depthTest) {
+        bucket = CommandList::BUCKET_ORDERED;       // Relies on submission order
+    } else if (alpha < 1.0f || recordState.additive) {
+        bucket = CommandList::BUCKET_TRANSLUCENT;
+    }
+    float depth = (position - recordState.cameraPosition).Length();
+    recordTarget->Add3D(op, bucket, depth, dataOffset);
+}
+
+void Renderer::RecordInstances(DrawOp op, const InstanceData* instances, size_t count, int segments) {
+    // The batch sorts as one packet placed at its centroid
+    Vec3 center(0.0f);
+    float minAlpha = 1.0f;
+    for (size_t i = 0; i < count; i++) {
+        center = center + instances[i].position;
+        minAlpha = std::min(minAlpha, instances[i].color.a);
+    }
+    center = center * (1.0f / (float)count);
+
+    InstanceArgs args = { (uint32_t)count, segments };
+    uint32_t offset = BeginPacket(&args, sizeof(args));
+    recordTarget->AppendData(instances, count * sizeof(InstanceData));
+    Record3D(op, offset, center, minAlpha);
+}
+
+void Renderer::CaptureRecordState() {
+    memcpy(recordState.projection, projectionMatrix, sizeof(recordState.projection));
+    memcpy(recordState.view, viewMatrix, sizeof(recordState.view));
+    recordState.cameraPosition = cameraPosition;
+    recordState.fogColor = fogColor;
+    recordState.fogDensity = fogDensity;
+    recordState.fogEnabled = fogEnabled;
+    recordState.fogCullThreshold = fogCullThreshold;
+    recordState.additive = additiveBlend;
+    recordState.depthTest = depthTest3D;
+    recordState.wireframe = wireframe;
+}
+
+void Renderer::ApplyStateBlock(const StateBlock& block) {
+    // Only re-upload FrameUniforms when something they carry changed
+    if (memcmp(projectionMatrix, block.projection, sizeof(projectionMatrix)) != 0 ||
+        memcmp(viewMatrix, block.view, sizeof(viewMatrix)) != 0 ||
+        memcmp(&cameraPosition, &block.cameraPosition, sizeof(Vec3)) != 0 ||
+        memcmp(&fogColor, &block.fogColor, sizeof(Vec3)) != 0 ||
+        fogDensity != block.fogDensity) {
+        memcpy(projectionMatrix, block.projection, sizeof(projectionMatrix));
+        memcpy(viewMatrix, block.view, sizeof(viewMatrix));
+        cameraPosition = block.cameraPosition;
+        fogColor = block.fogColor;
+        fogDensity = block.fogDensity;
+        frameUniformsDirty = true;
+        frustumDirty = true;
+    }
+    fogEnabled = block.fogEnabled;
+    fogCullThreshold = block.fogCullThreshold;
+    additiveBlend = block.additive;
+    depthTest3D = block.depthTest;
+    if (wireframe != block.wireframe) {
+        SetWireframe(block.wireframe);
+    }
+}
+
+void Renderer::Execute(CommandList& list) {
+    replayFrame = list.frame;
+    list.Sort();
+    SetTime(list.time);
+    if (list.profileScope) {
+        SetProfileScope(list.profileScope);
+    }
+
+    uint32_t appliedState = UINT32_MAX;
+    for (const DrawPacket& packet : list.packets) {
+        if (packet.stateIndex != appliedState && packet.stateIndex < list.states.size()) {
+            ApplyStateBlock(list.states[packet.stateIndex]);
+            appliedState = packet.stateIndex;
+        }
+
+        switch (packet.op) {
+            case DrawOp::Cube: {
+                const CubeArgs& a = list.Data<CubeArgs>(packet.dataOffset);
+                DrawCube(a.position, a.scale, a.color, a.rotation);
+                break;
+            }
+            case DrawOp::Sphere: {
+                const SphereArgs& a = list.Data<SphereArgs>(packet.dataOffset);
+                DrawSphere(a.position, a.radius, a.color, a.segments);
+                break;
+            }
+            case DrawOp::GpuMesh: {
+                const GpuMeshArgs& a = list.Data<GpuMeshArgs>(packet.dataOffset);
+                DrawMesh(a.mesh, a.position, a.scale, a.color, a.rotation);
+                break;
+            }
+            case DrawOp::CubesInstanced:
+            case DrawOp::SpheresInstanced: {
+                const InstanceArgs& a = list.Data<InstanceArgs>(packet.dataOffset);
+                const InstanceData* instances = reinterpret_cast<const InstanceData*>(
+                    list.Tail(packet.dataOffset, sizeof(InstanceArgs)));
+                if (packet.op == DrawOp::CubesInstanced) {
+                    DrawCubesInstanced(instances, a.count);
+                } else {
+                    DrawSpheresInstanced(instances, a.count, a.segments);
+                }
+                break;
+            }
+            case DrawOp::Line: {
+                const LineArgs& a = list.Data<LineArgs>(packet.dataOffset);
+                DrawLine(a.start, a.end, a.color, a.width);
+                break;
+            }
+            case DrawOp::Rect: {
+                const RectArgs& a = list.Data<RectArgs>(packet.dataOffset);
+                DrawRect(a.x, a.y, a.w, a.h, a.color);
+                break;
+            }
+            case DrawOp::Sprite: {
+                const SpriteArgs& a = list.Data<SpriteArgs>(packet.dataOffset);
+                DrawSprite(a.tex, a.x, a.y, a.w, a.h, a.tint);
+                break;
+            }
+            case DrawOp::GsSprite: {
+                const GsSpriteArgs& a = list.Data<GsSpriteArgs>(packet.dataOffset);
+                DrawSprite(a.tex, a.x, a.y, a.w, a.h, a.tint);
+                break;
+            }
+            case DrawOp::Text: {
+                const TextArgs& a = list.Data<TextArgs>(packet.dataOffset);
+                const char* text = reinterpret_cast<const char*>(list.Tail(packet.dataOffset, sizeof(TextArgs)));
+                DrawTextBox(text, a.x, a.y, a.width, a.align, a.color, a.scale);
+                break;
+            }
+        }
+    }
+}
+
+bool Renderer::NeedsInvoke() const {
+    return renderThread && renderThread->IsRunning() && !renderThread->IsCurrent();
+}
+
+// ============================================================================
+// Profiling
+// ============================================================================
+void Renderer::EnterPass(const char* pass) {
+    if (drawingOverlay || pass == currentPass) {
+        return;
+    }
+    if (currentPass) {
+        profiler.EndRegion(currentPass);
+    }
+    if (pass) {
+        profiler.BeginRegion(pass);
+    }
+    currentPass = pass;
+}
+
+RenderStats Renderer::GetRenderStats() const {
+    std::lock_guard<std::mutex> lock(renderStatsMutex);
+    return lastRenderStats;
+}
+
+void Renderer::CountDraw(uint32_t mode, size_t vertices, size_t indices, size_t instances) {
+    if (drawingOverlay) return;
+
+    RenderStats::Primitive primitive = RenderStats::PRIM_TRIANGLES;
+    if (mode == GL_LINES || mode == GL_LINE_STRIP || mode == GL_LINE_LOOP) primitive = RenderStats::PRIM_LINES;
+    if (mode == GL_POINTS) primitive = RenderStats::PRIM_POINTS;
+
+    size_t copies = instances ? instances : 1;
+    renderStats.drawCalls++;
+    renderStats.drawCallsByPrimitive[primitive]++;
+    renderStats.vertices += vertices * copies;
+    renderStats.indices += indices * copies;
+    renderStats.instances += instances;
+}
+
+void Renderer::DrawStatsOverlay(const RenderStats& stats) {
+    // Bottom right, clear of the profiler overlay
+    const float width = 280.0f;
+    const float lineH = 12.0f;
+    const float height = lineH * 10 + 8.0f;
+    const float x = 640.0f - width;
+    float y = 448.0f - height;
+    DrawRect(x - 4.0f, y - 4.0f, width, height, Color(0.0f, 0.0f, 0.0f, 0.7f));
+
+    DrawText("RENDER STATS (last frame)", x, y, Color(1.0f, 1.0f, 0.6f, 1.0f), 0.6f);
+    y += lineH;
+
+    char lines[9][64];
+    snprintf(lines[0], 64, "Draws     %d (%d tri, %d line)", stats.drawCalls,
+             stats.drawCallsByPrimitive[RenderStats::PRIM_TRIANGLES],
+             stats.drawCallsByPrimitive[RenderStats::PRIM_LINES]);
+    snprintf(lines[1], 64, "Batches   %d 2D, %llu instances", stats.quadBatches,
+             (unsigned long long)stats.instances);
+    snprintf(lines[2], 64, "Vertices  %llu", (unsigned long long)stats.vertices);
+    snprintf(lines[3], 64, "Indices   %llu", (unsigned long long)stats.indices);
+    snprintf(lines[4], 64, "Binds     %d tex, %d prog", stats.textureBinds, stats.programSwitches);
+    snprintf(lines[5], 64, "State     %d issued, %d elided", stats.stateCallsIssued, stats.stateCallsElided);
+    snprintf(lines[6], 64, "Upload    %.1f KB buf, %.1f KB tex",
+             stats.bufferUploadBytes / 1024.0, stats.textureUploadBytes / 1024.0);
+    snprintf(lines[7], 64, "Textures  +%d -%d", stats.texturesCreated, stats.texturesDeleted);
+    snprintf(lines[8], 64, "Culled    %d draws, %llu instances", stats.culledDraws,
+             (unsigned long long)stats.culledInstances);
+    for (const char* line : lines) {
+        DrawText(line, x, y, Color(1.0f, 1.0f, 1.0f, 1.0f), 0.6f);
+        y += lineH;
+    }
+}
+
+void Renderer::DrawProfilerOverlay() {
+    std::vector<GpuProfiler::RegionStats> stats = profiler.GetStats();
+
+    const float x = 8.0f;
+    const float lineH = 12.0f;
+    float y = 8.0f;
+    DrawRect(x - 4.0f, y - 4.0f, 380.0f, lineH * (stats.size() + 1) + 8.0f, Color(0.0f, 0.0f, 0.0f, 0.7f));
+
+    DrawText("REGION               GPU avg/max     CPU avg/max", x, y, Color(1.0f, 1.0f, 0.6f, 1.0f), 0.6f);
+    y += lineH;
+
+    char line[128];
+    for (const auto& s : stats) {
+        snprintf(line, sizeof(line), "%-20s %6.2f/%6.2f  %6.2f/%6.2f ms",
+                 s.name.c_str(), s.gpuAvgMs, s.gpuMaxMs, s.cpuAvgMs, s.cpuMaxMs);
+        DrawText(line, x, y, Color(1.0f, 1.0f, 1.0f, 1.0f), 0.6f);
+        y += lineH;
+    }
+}
+
+// ============================================================================
+// Basic Shader Setup
+// ============================================================================
+void Renderer::UseBasicShader(const float* model, const Color& tint, bool fog) {
+    // Projection, view, fog parameters and camera come from FrameUniforms
+    UpdateFrameUniforms();
+    Apply3DState();
+    state.UseProgram(basicShader.id);
+    basicShader.SetMat4("uModel", model);
+    basicShader.SetVec4("uTint", tint.r, tint.g, tint.b, tint.a);
+    basicShader.SetBool("fogEnabled", fog);
+}
+
+void Renderer::Apply3DState() {
+    EnterPass("3D");
+    state.SetDepthTest(depthTest3D);
+    state.SetBlend(true);
+    state.SetBlendFunc(GL_SRC_ALPHA, additiveBlend ? GL_ONE : GL_ONE_MINUS_SRC_ALPHA);
+}
+
+// ============================================================================
+// 2D Quad Batching
+// Screen-space quads are accumulated while (shader, texture, blend) stays the
+// same and drawn in one call on a key change, before any non-batched draw,
+// or at EndFrame. Submission order is preserved.
+// ============================================================================
+void Renderer::PushQuad(const Shader& shader, uint32_t texture, bool additive, const float* vertices) {
+    bool sameKey = quadShader == &shader && quadTexture == texture && quadAdditive == additive;
+    if (!sameKey || quadVertices.size() >= MAX_BATCH_QUADS * 48) {
+        FlushQuads();
+        quadShader = &shader;
+        quadTexture = texture;
+        quadAdditive = additive;
+    }
+    quadVertices.insert(quadVertices.end(), vertices, vertices + 48);
+}
+
+void Renderer::PushTextQuads(const TextLayout& layout, float x, float y, float boxWidth,
+                             TextAlign align, const Color& color) {
+    for (const TextLayout::Line& line : layout.lines) {
+        float shift = 0.0f;
+        if (align == TextAlign::Center) shift = floorf((boxWidth - line.width) * 0.5f);
+        if (align == TextAlign::Right) shift = floorf(boxWidth - line.width);
+        PushTextLine(layout.vertices.data() + (size_t)line.firstQuad * GLYPH_QUAD_FLOATS, line.quadCount,
+                     floorf(x) + shift, floorf(y), color);
+    }
+}
+
+void Renderer::PushTextLine(const float* src, size_t remaining, float offsetX, float offsetY, const Color& color) {
+    while (remaining > 0) {
+        bool sameKey = quadShader == &textShader && quadTexture == glyphArray && !quadAdditive;
+        if (!sameKey || quadVertices.size() >= MAX_BATCH_QUADS * GLYPH_QUAD_FLOATS) {
+            FlushQuads();
+            quadShader = &textShader;
+            quadTexture = glyphArray;
+            quadAdditive = false;
+        }
+
+        size_t count = std::min(remaining, MAX_BATCH_QUADS - quadVertices.size() / GLYPH_QUAD_FLOATS);
+        size_t base = quadVertices.size();
+        quadVertices.insert(quadVertices.end(), src, src + count * GLYPH_QUAD_FLOATS);
+
+        // Place and stamp the color into every vertex (layouts are stored white, at the origin)
+        for (size_t v = base; v < quadVertices.size(); v += 9) {
+            quadVertices[v + 0] += offsetX;
+            quadVertices[v + 1] += offsetY;
+            quadVertices[v + 5] = color.r;
+            quadVertices[v + 6] = color.g;
+            quadVertices[v + 7] = color.b;
+            quadVertices[v + 8] = color.a;
+        }
+
+        src += count * GLYPH_QUAD_FLOATS;
+        remaining -= count;
+    }
+}
+
+void Renderer::FlushQuads() {
+    if (quadVertices.empty()) {
+        return;
+    }
+
+    // A shader that failed to build draws nothing rather than running program 0
+    if (!quadShader || !quadShader->valid) {
+        quadVertices.clear();
+        return;
+    }
+
+    // Text batches carry the glyph layer (9 floats per vertex), sprites don't
+
+    bool text = quadShader == &textShader;
+    size_t stride = text ? 9 : 8;
+    size_t numVertices = quadVertices.size() / stride;
+    int baseVertex = PushVertices(quadVertices.data(), numVertices, stride * sizeof(float));
+    quadVertices.clear();
+    if (baseVertex < 0) return;
+
+    EnterPass(text ? "Text" : "Sprites");
+
+    // 3D draws set their own state, so nothing is restored afterwards
+    state.SetDepthTest(false);
+    state.SetBlend(true);
+    state.SetBlendFunc(GL_SRC_ALPHA, quadAdditive ? GL_ONE : GL_ONE_MINUS_SRC_ALPHA);
+
+    UpdateFrameUniforms();
+    state.BindVertexArray(text ? glyphVao : textVao);
+    state.UseProgram(quadShader->id);
+    if (quadShader == &spriteShader) {
+        quadShader->SetBool("uUseTexture", quadTexture != 0);
+    } else if (quadShader == &gsSpriteShader) {
+        quadShader->SetInt("uPsm", quadGsTexture.psm);
+        quadShader->SetIVec2("uSize", quadGsTexture.width, quadGsTexture.height);
+        quadShader->SetBool("uHasClut", quadGsTexture.clut != 0);
+        state.BindTexture(1, quadGsTexture.clut);
+    }
+
+    if (text) {
+        state.BindTextureArray(0, quadTexture);
+    } else {
+        state.BindTexture(0, quadTexture);
+    }
+    glDrawArrays(GL_TRIANGLES, baseVertex, (GLsizei)numVertices);
+    CountDraw(GL_TRIANGLES, numVertices, 0);
+    if (!drawingOverlay) renderStats.quadBatches++;
+}
+
+// ============================================================================
+// Debug Drawing
+// ============================================================================
+void Renderer::DrawDebugGrid(float size, int divisions) {
+    Color gridColor(0.3f, 0.3f, 0.3f, 0.5f);
+    float halfSize = size / 2.0f;
+    float step = size / divisions;
+    
+    for (int i = 0; i <= divisions; i++) {
+        float pos = -halfSize + i * step;
+        DrawLine(Vec3(pos, 0, -halfSize), Vec3(pos, 0, halfSize), gridColor);
+        DrawLine(Vec3(-halfSize, 0, pos), Vec3(halfSize, 0, pos), gridColor);
+    }
+}
+
+void Renderer::DrawDebugAxis(float length) {
+    DrawLine(Vec3(0, 0, 0), Vec3(length, 0, 0), Color(1.0f, 0.0f, 0.0f, 1.0f), 2.0f);
+    DrawLine(Vec3(0, 0, 0), Vec3(0, length, 0), Color(0.0f, 1.0f, 0.0f, 1.0f), 2.0f);
+    DrawLine(Vec3(0, 0, 0), Vec3(0, 0, length), Color(0.0f, 0.0f, 1.0f, 1.0f), 2.0f);
+}
+
+// ============================================================================
+// Texture Management
+// ============================================================================
+Texture Renderer::LoadTexture(const std::string& path) {
+    if (NeedsInvoke()) {
+        Texture result;
+        renderThread->Invoke([&] { result = LoadTexture(path); });
+        return result;
+    }
+    TexData texData;
+    if (!textureLoader.LoadFromPath(path, texData)) {
+        printf("[Renderer] Failed to load texture: %s\n", path.c_str());
+        return Texture();
+    }
+    return CreateTexture(texData.pixels.data(), texData.width, texData.height, 4);
+}
+
+Texture Renderer::LoadTextureByName(const std::string& name) {
+    if (NeedsInvoke()) {
+        Texture result;
+        renderThread->Invoke([&] { result = LoadTextureByName(name); });
+        return result;
+    }
+    TexData texData;
+    if (!textureLoader.Load(name, texData)) {
+        printf("[Renderer] Failed to load texture: %s\n", name.c_str());
+        return Texture();
+    }
+    return CreateTexture(texData.pixels.data(), texData.width, texData.height, 4);
+}
+
+// Packs every small TEX* asset into shared pages up front, so sprites from
+// different assets batch under one texture binding
+void Renderer::BuildTextureAtlas() {
+    struct Pending {
+        std::string name;
+        TexData data;
+    };
+    std::vector<Pending> pending;
+    for (const std::string& name : textureLoader.GetAvailableTextures()) {
+        Pending item;
+        item.name = name;
+        if (textureLoader.Load(name, item.data) && TextureAtlas::Fits(item.data.width, item.data.height)) {
+            pending.push_back(std::move(item));
+        }
+    }
+    if (pending.empty()) return;
+
+    // Tallest first keeps the shelves tight
+    std::sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+        return a.data.height != b.data.height ? a.data.height > b.data.height : a.data.width > b.data.width;
+    });
+
+    std::vector<std::pair<std::string, TextureAtlas::Entry>> entries;
+    for (const Pending& item : pending) {
+        TextureAtlas::Entry entry;
+        if (textureAtlas.Add(item.data, entry)) {
+            entries.emplace_back(item.name, entry);
+        }
+    }
+
+    for (int i = 0; i < textureAtlas.GetPageCount(); i++) {
+        const TextureAtlas::Page& page = textureAtlas.GetPage(i);
+        Texture pageTex = CreateTexture(page.pixels.data(), TextureAtlas::PAGE_SIZE, TextureAtlas::PAGE_SIZE, 4);
+        atlasPages.push_back(pageTex.valid ? pageTex.id : 0);
+        printf("[Renderer] Atlas page %d: %.0f%% used\n", i,
+               100.0f * page.usedPixels / (TextureAtlas::PAGE_SIZE * TextureAtlas::PAGE_SIZE));
+    }
+    textureAtlas.ReleaseStaging();
+
+    const float inv = 1.0f / TextureAtlas::PAGE_SIZE;
+    for (const auto& pair : entries) {
+        const TextureAtlas::Entry& entry = pair.second;
+        if (!atlasPages[entry.page]) continue;
+
+        Texture tex;
+        tex.id = atlasPages[entry.page];
+        tex.width = entry.width;
+        tex.height = entry.height;
+        tex.u0 = entry.x * inv;
+        tex.v0 = entry.y * inv;
+        tex.u1 = (entry.x + entry.width) * inv;
+        tex.v1 = (entry.y + entry.height) * inv;
+        tex.atlased = true;
+        tex.valid = true;
+
+        // Pages stay for the renderer's lifetime, so their entries are pinned
+        CachedTexture& cached = textureCache[pair.first];
+        cached.texture = tex;
+        cached.pin = PIN_ALWAYS;
+    }
+
+    printf("[Renderer] Texture atlas: %zu textures in %d page(s)\n", entries.size(), textureAtlas.GetPageCount());
+}
+
+Texture Renderer::GetCachedTexture(const std::string& name) {
+    auto it = textureCache.find(name);
+    if (it != textureCache.end()) {
+        it->second.lastUsedFrame = frameCounter;
+        if (it->second.pin == PIN_NONE) it->second.pin = PIN_SCENE;
+        textureCacheStats.hits++;
+        return it->second.texture;
+    }
+    if (NeedsInvoke()) {
+        Texture result;
+        renderThread->Invoke([&] { result = GetCachedTexture(name); });
+        return result;
+    }
+    textureCacheStats.misses++;
+
+    TexData texData;
+    if (!textureLoader.Load(name, texData)) {
+        printf("[Renderer] Failed to load texture: %s\n", name.c_str());
+        return Texture();
+    }
+    size_t bytes = (size_t)texData.width * texData.height * 4;
+    EvictTextures(bytes);
+
+    Texture tex = CreateTexture(texData.pixels.data(), texData.width, texData.height, 4);
+    if (tex.valid) {
+        CachedTexture& cached = textureCache[name];
+        cached.texture = tex;
+        cached.bytes = bytes;
+        cached.lastUsedFrame = frameCounter;
+        cached.pin = PIN_SCENE;     // Used by the loaded scene until the next scene change
+        textureCacheBytes += bytes;
+    }
+    return tex;
+}
+
+// ============================================================================
+// Texture Cache Budget
+// Eviction only touches entries idle for textureCacheMinIdle frames, so a
+// texture drawn every few frames is not thrashed; lists still in flight are
+// covered by DeleteTexture's deferral. Pinned entries may push usage over budget.
+// ============================================================================
+void Renderer::EvictTextures(size_t incomingBytes) {
+    uint64_t frame = frameCounter;
+    while (textureCacheBytes + incomingBytes > textureCacheBudget) {
+        auto victim = textureCache.end();
+        for (auto it = textureCache.begin(); it != textureCache.end(); ++it) {
+            const CachedTexture& cached = it->second;
+            if (cached.pin != PIN_NONE || cached.texture.atlased) continue;
+            if (frame - cached.lastUsedFrame < (uint64_t)textureCacheMinIdle) continue;
+            if (victim == textureCache.end() || cached.lastUsedFrame < victim->second.lastUsedFrame) {
+                victim = it;
+            }
+        }
+        if (victim == textureCache.end()) break;   // Everything left is pinned or in use
+
+        textureCacheBytes -= victim->second.bytes;
+        DeleteTexture(victim->second.texture);
+        textureCache.erase(victim);
+        textureCacheStats.evictions++;
+    }
+}
+
+void Renderer::SetTextureCacheBudget(size_t bytes, int minIdleFrames) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { SetTextureCacheBudget(bytes, minIdleFrames); });
+        return;
+    }
+    textureCacheBudget = bytes;
+    textureCacheMinIdle = std::max(minIdleFrames, RenderThread::LIST_COUNT + 1);
+    EvictTextures(0);
+    printf("[Renderer] Texture cache budget %zu KB (min idle %d frames)\n", bytes / 1024, textureCacheMinIdle);
+}
+
+void Renderer::PinCachedTexture(const std::string& name, TexturePin pin) {
+    if (!GetCachedTexture(name).valid) return;
+    CachedTexture& cached = textureCache[name];
+    if (cached.pin != PIN_ALWAYS) cached.pin = pin;
+}
+
+void Renderer::PinTexture(const std::string& name) {
+    PinCachedTexture(name, PIN_ALWAYS);
+}
+
+void Renderer::PinSceneTexture(const std::string& name) {
+    PinCachedTexture(name, PIN_SCENE);
+}
+
+void Renderer::ReleaseSceneTextures() {
+    for (auto& pair : textureCache) {
+        if (pair.second.pin == PIN_SCENE) pair.second.pin = PIN_NONE;
+    }
+}
+
+TextureCacheStats Renderer::GetTextureCacheStats() const {
+    TextureCacheStats stats = textureCacheStats;
+    size_t atlasBytes = atlasPages.size() * TextureAtlas::PAGE_SIZE * TextureAtlas::PAGE_SIZE * 4;
+    size_t fontBytes = glyphArrayBytes;
+
+    stats.residentBytes = textureCacheBytes + atlasBytes + fontBytes;
+    stats.pinnedBytes = atlasBytes + fontBytes;
+    for (const auto& pair : textureCache) {
+        if (pair.second.pin != PIN_NONE) stats.pinnedBytes += pair.second.bytes;
+    }
+    stats.pooledBytes = texturePoolBytes;
+    stats.budgetBytes = textureCacheBudget;
+    stats.entries = (int)textureCache.size();
+    return stats;
+}
+
+Texture Renderer::CreateTexture(const uint8_t* data, int width, int height, int channels) {
+    if (NeedsInvoke()) {
+        Texture result;
+        renderThread->Invoke([&] { result = CreateTexture(data, width, height, channels); });
+        return result;
+    }
+    Texture tex;
+    tex.id = AcquireTexture(width, height, channels);
+    if (!tex.id) return tex;
+
+    tex.width = width;
+    tex.height = height;
+    tex.channels = channels;
+    if (data) {
+        UploadTexture(tex.id, data, width, height, channels);
+    }
+    tex.valid = true;
+    return tex;
+}
+
+void Renderer::DeleteTexture(Texture& tex) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { DeleteTexture(tex); });
+        return;
+    }
+    if (tex.atlased) {
+        // Page is shared with other entries; only drop the handle
+        tex = Texture();
+        return;
+    }
+    if (tex.valid && tex.id) {
+        if (IsFrameInFlight()) {
+            DeferredDelete pending = { DeferredDelete::TEXTURE, frameCounter };
+            pending.texture = tex;
+            deferredDeletes.push_back(pending);
+        } else {
+            if (tex.id == quadTexture) FlushQuads();
+            ReleaseTexture(tex);
+        }
+        tex.id = 0;
+        tex.valid = false;
+    }
+}
+
+// GL thread, after each frame and at shutdown
+void Renderer::FlushDeferredDeletes() {
+    size_t kept = 0;
+    for (DeferredDelete& pending : deferredDeletes) {
+        if (pending.frame > completedFrame) {
+            deferredDeletes[kept++] = pending;
+            continue;
+        }
+        switch (pending.kind) {
+            case DeferredDelete::TEXTURE:    ReleaseTexture(pending.texture); break;
+            case DeferredDelete::GS_TEXTURE: FreeGsTexture(pending.gsTexture); break;
+            case DeferredDelete::MESH:       FreeMesh(pending.mesh); break;
+        }
+    }
+    deferredDeletes.resize(kept);
+}
+
+// ============================================================================
+// Texture Pool + Uploads
+// ============================================================================
+static void GetTextureFormat(int channels, GLenum& internalFormat, GLenum& format) {
+    switch (channels) {
+        case 1:  internalFormat = GL_R8;    format = GL_RED;  break;
+        case 3:  internalFormat = GL_RGB8;  format = GL_RGB;  break;
+        default: internalFormat = GL_RGBA8; format = GL_RGBA; break;
+    }
+}
+
+static uint64_t TexturePoolKey(int width, int height, int channels) {
+    return ((uint64_t)(uint32_t)width << 32) | ((uint64_t)(uint16_t)height << 8) | (uint8_t)channels;
+}
+
+uint32_t Renderer::AcquireTexture(int width, int height, int channels) {
+    auto it = texturePool.find(TexturePoolKey(width, height, channels));
+    if (it != texturePool.end() && !it->second.empty()) {
+        uint32_t id = it->second.back();
+        it->second.pop_back();
+        texturePoolBytes -= (size_t)width * height * channels;
+        return id;
+    }
+
+    GLenum internalFormat, format;
+    GetTextureFormat(channels, internalFormat, format);
+
+    GLuint id = 0;
+    glGenTextures(1, &id);
+    renderStats.texturesCreated++;
+    state.BindTexture(0, id);
+    if (GLEW_ARB_texture_storage) {
+        glTexStorage2D(GL_TEXTURE_2D, 1, internalFormat, width, height);
+    } else {
+        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+    }
+
+    if (channels == 1) {
+        // Canal R atua como Alpha (fonte)
+        GLint swizzleMask[] = {GL_ONE, GL_ONE, GL_ONE, GL_RED};
+        glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+
+    // Configuração para ficar "Crocante" igual PS2
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    return id;
+}
+
+void Renderer::ReleaseTexture(Texture& tex) {
+    size_t bytes = (size_t)tex.width * tex.height * tex.channels;
+    if (tex.channels > 0 && texturePoolBytes + bytes <= TEXTURE_POOL_BUDGET) {
+        texturePool[TexturePoolKey(tex.width, tex.height, tex.channels)].push_back(tex.id);
+        texturePoolBytes += bytes;
+        return;
+    }
+    state.ForgetTexture(tex.id);
+    glDeleteTextures(1, &tex.id);
+    renderStats.texturesDeleted++;
+}
+
+void Renderer::UploadTexture(uint32_t id, const uint8_t* data, int width, int height, int channels) {
+    GLenum internalFormat, format;
+    GetTextureFormat(channels, internalFormat, format);
+
+    state.BindTexture(0, id);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    // The ring fences each segment, so staging never overwrites a copy still in flight
+    size_t bytes = (size_t)width * height * channels;
+    renderStats.textureUploadBytes += bytes;
+    size_t offset = uploadStream.Push(data, bytes, 4);
+    if (offset != SIZE_MAX) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uploadStream.id);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE,
+                        reinterpret_cast<const void*>(offset));
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    } else {
+        // Larger than one ring segment (atlas pages, font banks)
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, format, GL_UNSIGNED_BYTE, data);
+    }
+}
+
+// ============================================================================
+// Raw GS Textures
+// The payload is uploaded byte-for-byte as an integer texture, DATA_WIDTH
+// texels per row, so gs_sprite.frag can address it like GS memory
+// ============================================================================
+GsTexture Renderer::CreateGsTexture(const GsRawData& raw) {
+    if (NeedsInvoke()) {
+        GsTexture result;
+        renderThread->Invoke([&] { result = CreateGsTexture(raw); });
+        return result;
+    }
+    GsTexture tex;
+    if (raw.width <= 0 || raw.height <= 0 || raw.data.empty()) return tex;
+
+    // Texel size follows the GS word the address math works in
+    GLenum internalFormat = GL_R8UI;
+    GLenum type = GL_UNSIGNED_BYTE;
+    size_t texelBytes = 1;
+    if (raw.psm == GS_PSM_32) {
+        internalFormat = GL_R32UI; type = GL_UNSIGNED_INT; texelBytes = 4;
+    } else if (raw.psm == GS_PSM_16 || raw.psm == GS_PSM_16S) {
+        internalFormat = GL_R16UI; type = GL_UNSIGNED_SHORT; texelBytes = 2;
+    }
+
+    // Payloads are page-padded by the loader; pad the last row if a dump is odd-sized
+    size_t rowBytes = GsTexture::DATA_WIDTH * texelBytes;
+    size_t rows = (raw.data.size() + rowBytes - 1) / rowBytes;
+    const uint8_t* pixels = raw.data.data();
+    std::vector<uint8_t> padded;
+    if (rows * rowBytes != raw.data.size()) {
+        padded.assign(rows * rowBytes, 0);
+        memcpy(padded.data(), raw.data.data(), raw.data.size());
+        pixels = padded.data();
+    }
+
+    glGenTextures(1, &tex.id);
+    state.BindTexture(0, tex.id);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, GsTexture::DATA_WIDTH, (GLsizei)rows, 0,
+                 GL_RED_INTEGER, type, pixels);
+    renderStats.texturesCreated++;
+    renderStats.textureUploadBytes += rows * rowBytes;
+    // Integer textures are only complete with nearest filtering
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    if (!raw.clut.empty()) {
+        // ABGR words are R,G,B,A in memory (little-endian)
+        std::vector<uint32_t> palette(256, 0);
+        memcpy(palette.data(), raw.clut.data(), std::min<size_t>(raw.clut.size(), 256) * sizeof(uint32_t));
+        glGenTextures(1, &tex.clut);
+        state.BindTexture(0, tex.clut);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 256, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, palette.data());
+        renderStats.texturesCreated++;
+        renderStats.textureUploadBytes += palette.size() * sizeof(uint32_t);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    tex.width = raw.width;
+    tex.height = raw.height;
+    tex.psm = raw.psm;
+    tex.valid = true;
+    printf("[Renderer] GS texture %dx%d (psm %d, %zu bytes%s)\n", tex.width, tex.height, tex.psm,
+           rows * rowBytes, tex.clut ? ", CLUT" : "");
+    return tex;
+}
+
+GsTexture Renderer::LoadGsTexture(const std::string& name) {
+    if (NeedsInvoke()) {
+        GsTexture result;
+        renderThread->Invoke([&] { result = LoadGsTexture(name); });
+        return result;
+    }
+    GsRawData raw;
+    if (!textureLoader.LoadRaw(name, raw)) {
+        printf("[Renderer] Failed to load GS texture: %s\n", name.c_str());
+        return GsTexture();
+    }
+    return CreateGsTexture(raw);
+}
+
+void Renderer::DeleteGsTexture(GsTexture& tex) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { DeleteGsTexture(tex); });
+        return;
+    }
+    if (!tex.valid) return;
+    if (IsFrameInFlight()) {
+        DeferredDelete pending = { DeferredDelete::GS_TEXTURE, frameCounter };
+        pending.gsTexture = tex;
+        deferredDeletes.push_back(pending);
+        tex = GsTexture();
+        return;
+    }
+    FreeGsTexture(tex);
+}
+
+void Renderer::FreeGsTexture(GsTexture& tex) {
+    if (tex.id == quadTexture) FlushQuads();
+    state.ForgetTexture(tex.id);
+    glDeleteTextures(1, &tex.id);
+    renderStats.texturesDeleted++;
+    if (tex.clut) {
+        state.ForgetTexture(tex.clut);
+        glDeleteTextures(1, &tex.clut);
+        renderStats.texturesDeleted++;
+    }
+    tex = GsTexture();
+}
+
+// ============================================================================
+// Render Targets
+// ============================================================================
+RenderTarget Renderer::CreateRenderTarget(int width, int height, bool depth) {
+    RenderTarget target;
+    if (width <= 0 || height <= 0) {
+        printf("[Renderer] Invalid render target size %dx%d\n", width, height);
+        return target;
+    }
+
+    glGenTextures(1, &target.colorTex);
+    renderStats.texturesCreated++;
+    state.BindTexture(0, target.colorTex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    // Linear: the postfx upscale picks texel centers itself for nearest
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    if (depth) {
+        glGenRenderbuffers(1, &target.depthRb);
+        glBindRenderbuffer(GL_RENDERBUFFER, target.depthRb);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    }
 
-    while (*text) {
-        char c = *text++;
-        
-        if (c == '\n') {
-            curX = x;
-            curY += glyphH + 2.0f * scale;
-            continue;
-        }
+    glGenFramebuffers(1, &target.fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, target.fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target.colorTex, 0);
+    if (depth) {
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target.depthRb);
+    }
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-        const FontGlyph& glyph = fontLoader.GetGlyph(c);
-        float glyphW = glyph.width * scale;
-        float advance = glyph.advance * scale;
+    target.width = width;
+    target.height = height;
+    target.valid = true;
 
-        // Skip rendering for space but advance cursor
-        if (c == ' ') {
-            curX += floorf(advance);
-            continue;
-        }
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        printf("[Renderer] Render target %dx%d incomplete (0x%04X)\n", width, height, status);
+        DeleteRenderTarget(target);
+        return target;
+    }
 
-        // Quad vertices: pos.x, pos.y, tex.u, tex.v, color.r, g, b, a
-        // Bottom-left
-        // Usar coordenadas arredondadas para alinhamento pixel-perfect
-        float x0 = floorf(curX);
-        float y0 = floorf(curY);
-        float x1 = floorf(curX + glyphW);
-        float y1 = floorf(curY + glyphH);
-        
-        vertices.push_back(x0);
-        vertices.push_back(y1);
-        vertices.push_back(glyph.u0);
-        vertices.push_back(glyph.v1);
-        vertices.push_back(color.r);
-        vertices.push_back(color.g);
-        vertices.push_back(color.b);
-        vertices.push_back(color.a);
+    printf("[Renderer] Created render target %dx%d%s\n", width, height, depth ? "" : " (color only)");
+    return target;
+}
 
-        // Bottom-right
-        vertices.push_back(x1);
-        vertices.push_back(y1);
-        vertices.push_back(glyph.u1);
-        vertices.push_back(glyph.v1);
-        vertices.push_back(color.r);
-        vertices.push_back(color.g);
-        vertices.push_back(color.b);
-        vertices.push_back(color.a);
+void Renderer::DeleteRenderTarget(RenderTarget& target) {
+    if (!target.valid) return;
+    FlushQuads();
+    state.ForgetTexture(target.colorTex);
+    glDeleteFramebuffers(1, &target.fbo);
+    if (target.depthRb) glDeleteRenderbuffers(1, &target.depthRb);
+    glDeleteTextures(1, &target.colorTex);
+    renderStats.texturesDeleted++;
+    target = RenderTarget();
+}
 
-        // Top-right
-        vertices.push_back(x1);
-        vertices.push_back(y0);
-        vertices.push_back(glyph.u1);
-        vertices.push_back(glyph.v0);
-        vertices.push_back(color.r);
-        vertices.push_back(color.g);
-        vertices.push_back(color.b);
-        vertices.push_back(color.a);
-
-        // Top-right (duplicate for second triangle)
-        vertices.push_back(x1);
-        vertices.push_back(y0);
-        vertices.push_back(glyph.u1);
-        vertices.push_back(glyph.v0);
-        vertices.push_back(color.r);
-        vertices.push_back(color.g);
-        vertices.push_back(color.b);
-        vertices.push_back(color.a);
+void Renderer::SetInternalResolution(int width, int height) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { SetInternalResolution(width, height); });
+        return;
+    }
+    if (width <= 0 || height <= 0) return;
+    if (width == internalWidth && height == internalHeight && sceneTarget.valid) return;
+
+    internalWidth = width;
+    internalHeight = height;
+    DeleteRenderTarget(sceneTarget);
+    sceneTarget = CreateRenderTarget(width, height);
+    CreateBloomTargets();
+    printf("[Renderer] Internal resolution %dx%d\n", width, height);
+}
 
-        // Top-left
-        vertices.push_back(x0);
-        vertices.push_back(y0);
-        vertices.push_back(glyph.u0);
-        vertices.push_back(glyph.v0);
-        vertices.push_back(color.r);
-        vertices.push_back(color.g);
-        vertices.push_back(color.b);
-        vertices.push_back(color.a);
-
-        // Bottom-left (duplicate for second triangle)
-        vertices.push_back(x0);
-        vertices.push_back(y1);
-        vertices.push_back(glyph.u0);
-        vertices.push_back(glyph.v1);
-        vertices.push_back(color.r);
-        vertices.push_back(color.g);
-        vertices.push_back(color.b);
-        vertices.push_back(color.a);
-
-        curX += floorf(advance);
-    }
-
-    if (vertices.empty()) {
+void Renderer::SetBloom(bool enabled, float intensity, float threshold) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { SetBloom(enabled, intensity, threshold); });
         return;
     }
+    bloomEnabled = enabled;
+    bloomIntensity = intensity;
+    bloomThreshold = threshold;
+}
 
-    // Render
-    glDisable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+bool Renderer::IsBloomActive() const {
+    return bloomEnabled && bloomLevelCount > 0 &&
+           bloomDownShader.valid && bloomUpShader.valid &&
+           postFxShader.valid && sceneTarget.valid;
+}
 
-    glBindVertexArray(textVao);
-    glBindBuffer(GL_ARRAY_BUFFER, textVbo);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
+void Renderer::SetOutputSize(int width, int height) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { SetOutputSize(width, height); });
+        return;
+    }
+    outputWidth = width;
+    outputHeight = height;
+}
 
-    // Stride: 8 floats (pos.xy, tex.uv, color.rgba)
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(2 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(4 * sizeof(float)));
-    glEnableVertexAttribArray(2);
+void Renderer::SetOutputTarget(const RenderTarget* target) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { SetOutputTarget(target); });
+        return;
+    }
+    outputTarget = (target && target->valid) ? target : nullptr;
+}
+
+void Renderer::SetUpscaleFilter(UpscaleFilter filter) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { SetUpscaleFilter(filter); });
+        return;
+    }
+    upscaleFilter = filter;
+}
 
-    textShader.Use();
-    textShader.SetMat4("uProjection", orthoMatrix);
-    textShader.SetInt("uFontAtlas", 0);
+void Renderer::BindTarget(const RenderTarget* target, int width, int height) {
+    glBindFramebuffer(GL_FRAMEBUFFER, target ? target->fbo : 0);
+    if (target) {
+        width = target->width;
+        height = target->height;
+    }
+    if (width > 0 && height > 0) {
+        glViewport(0, 0, width, height);
+    }
+}
 
-    fontTexture.Bind(0);
+// Bright-pass + dual-filter blur: downsample scene -> level 0 -> ... -> smallest,
+// then upsample back, adding each level into the next larger one
+bool Renderer::RenderBloom() {
+    if (!IsBloomActive()) {
+        return false;
+    }
 
-    size_t numVertices = vertices.size() / 8;
-    glDrawArrays(GL_TRIANGLES, 0, (GLsizei)numVertices);
+    EnterPass("Bloom");
+    state.SetDepthTest(false);
+    state.SetCullFace(false);
+    state.SetBlend(false);
+    state.BindVertexArray(postVao);
+
+    float threshold = bloomThreshold;
+    state.UseProgram(bloomDownShader.id);
+    bloomDownShader.SetFloat("threshold", threshold);
+    bloomDownShader.SetFloat("knee", threshold * 0.5f);
+
+    const RenderTarget* source = &sceneTarget;
+    for (int i = 0; i < bloomLevelCount; i++) {
+        BindTarget(&bloomTargets[i], 0, 0);
+        bloomDownShader.SetBool("brightPass", i == 0);
+        bloomDownShader.SetVec2("texelSize", 1.0f / source->width, 1.0f / source->height);
+        state.BindTexture(0, source->colorTex);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        CountDraw(GL_TRIANGLES, 3, 0);
+        source = &bloomTargets[i];
+    }
 
-    fontTexture.Unbind();
-    glEnable(GL_DEPTH_TEST);
+    state.UseProgram(bloomUpShader.id);
+    state.SetBlend(true);
+    state.SetBlendFunc(GL_ONE, GL_ONE);
+    for (int i = bloomLevelCount - 1; i > 0; i--) {
+        BindTarget(&bloomTargets[i - 1], 0, 0);
+        bloomUpShader.SetVec2("texelSize", 1.0f / bloomTargets[i].width, 1.0f / bloomTargets[i].height);
+        state.BindTexture(0, bloomTargets[i].colorTex);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        CountDraw(GL_TRIANGLES, 3, 0);
+    }
+    state.SetBlend(false);
+    return true;
 }
 
-float Renderer::GetTextWidth(const char* text, float scale) {
-    if (!fontLoaded) {
-        return strlen(text) * 10.0f * scale;
+void Renderer::CreateBloomTargets() {
+    DeleteBloomTargets();
+    int width = internalWidth / 2;
+    int height = internalHeight / 2;
+    while (bloomLevelCount < BLOOM_LEVELS && width >= 4 && height >= 4) {
+        RenderTarget target = CreateRenderTarget(width, height, false);
+        if (!target.valid) break;
+        bloomTargets[bloomLevelCount++] = target;
+        width /= 2;
+        height /= 2;
     }
-    return fontLoader.GetTextWidth(text, scale);
 }
 
-// ============================================================================
-// Debug Drawing
-// ============================================================================
-void Renderer::DrawDebugGrid(float size, int divisions) {
-    Color gridColor(0.3f, 0.3f, 0.3f, 0.5f);
-    float halfSize = size / 2.0f;
-    float step = size / divisions;
-    
-    for (int i = 0; i <= divisions; i++) {
-        float pos = -halfSize + i * step;
-        DrawLine(Vec3(pos, 0, -halfSize), Vec3(pos, 0, halfSize), gridColor);
-        DrawLine(Vec3(-halfSize, 0, pos), Vec3(halfSize, 0, pos), gridColor);
+void Renderer::DeleteBloomTargets() {
+    for (int i = 0; i < bloomLevelCount; i++) {
+        DeleteRenderTarget(bloomTargets[i]);
     }
+    bloomLevelCount = 0;
 }
 
-void Renderer::DrawDebugAxis(float length) {
-    DrawLine(Vec3(0, 0, 0), Vec3(length, 0, 0), Color(1.0f, 0.0f, 0.0f, 1.0f), 2.0f);
-    DrawLine(Vec3(0, 0, 0), Vec3(0, length, 0), Color(0.0f, 1.0f, 0.0f, 1.0f), 2.0f);
-    DrawLine(Vec3(0, 0, 0), Vec3(0, 0, length), Color(0.0f, 0.0f, 1.0f, 1.0f), 2.0f);
+// Scene target -> output in one fullscreen pass (bloom composite, dither,
+// upscale), with the internal aspect ratio kept by letterboxing
+void Renderer::ResolveFrame() {
+    if (!sceneTarget.valid) return;
+
+    if (wireframe) glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    bool bloom = RenderBloom();
+
+    EnterPass("PostFX");
+
+    int outW = outputTarget ? outputTarget->width : (int)outputWidth;
+    int outH = outputTarget ? outputTarget->height : (int)outputHeight;
+    BindTarget(outputTarget, outW, outH);
+
+    float scale = std::min(outW / (float)internalWidth, outH / (float)internalHeight);
+    int viewW = std::max(1, (int)(internalWidth * scale + 0.5f));
+    int viewH = std::max(1, (int)(internalHeight * scale + 0.5f));
+    int viewX = (outW - viewW) / 2;
+    int viewY = (outH - viewH) / 2;
+
+    if (viewW != outW || viewH != outH) {
+        static const GLfloat black[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+        glClearBufferfv(GL_COLOR, 0, black);
+    }
+
+    if (postFxShader.valid) {
+        glViewport(viewX, viewY, viewW, viewH);
+        state.SetDepthTest(false);
+        state.SetBlend(false);
+        state.SetCullFace(false);
+
+        state.UseProgram(postFxShader.id);
+        postFxShader.SetVec2("sourceSize", (float)internalWidth, (float)internalHeight);
+        postFxShader.SetVec2("outputSize", (float)viewW, (float)viewH);
+        postFxShader.SetBool("sharpFilter", upscaleFilter == UpscaleFilter::SharpBilinear);
+        postFxShader.SetBool("bloomEnabled", bloom);
+        if (bloom) {
+            postFxShader.SetFloat("bloomIntensity", bloomIntensity);
+            state.BindTexture(1, bloomTargets[0].colorTex);
+        }
+        state.BindTexture(0, sceneTarget.colorTex);
+        state.BindVertexArray(postVao);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        CountDraw(GL_TRIANGLES, 3, 0);
+    } else {
+        // No post shader: plain blit (nearest)
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, sceneTarget.fbo);
+        glBlitFramebuffer(0, 0, internalWidth, internalHeight,
+                          viewX, viewY, viewX + viewW, viewY + viewH,
+                          GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, outputTarget ? outputTarget->fbo : 0);
+    }
+
+    if (wireframe) glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+    EnterPass(nullptr);
 }
 
 // ============================================================================
-// Texture Management
+// Mesh Management
 // ============================================================================
-Texture Renderer::LoadTexture(const std::string& path) {
-    TexData texData;
-    if (!textureLoader.LoadFromPath(path, texData)) {
-        printf("[Renderer] Failed to load texture: %s\n", path.c_str());
-        return Texture();
+GpuMesh Renderer::CreateMesh(const ICOBModel& model) {
+    if (NeedsInvoke()) {
+        GpuMesh result;
+        renderThread->Invoke([&] { result = CreateMesh(model); });
+        return result;
     }
-    return CreateTexture(texData.pixels.data(), texData.width, texData.height, 4);
+    if (model.vertices.empty() || model.indices.empty()) {
+        return GpuMesh();
+    }
+
+    std::vector<float> vertices;
+    PackMeshVertices(model, vertices);
+    return CreateStaticMesh(vertices.data(), model.vertices.size(),
+                            model.indices.data(), model.indices.size() * sizeof(uint16_t),
+                            GL_UNSIGNED_SHORT, (int)model.indices.size());
 }
 
-Texture Renderer::LoadTextureByName(const std::string& name) {
-    TexData texData;
-    if (!textureLoader.Load(name, texData)) {
-        printf("[Renderer] Failed to load texture: %s\n", name.c_str());
-        return Texture();
-    }
-    return CreateTexture(texData.pixels.data(), texData.width, texData.height, 4);
+GpuMesh Renderer::CreateStaticMesh(const float* vertices, size_t vertexCount,
+                                   const void* indices, size_t indexBytes,
+                                   uint32_t indexType, int indexCount) {
+    GpuMesh mesh;
+    mesh.vertexCount = (int)vertexCount;
+    mesh.indexCount = indexCount;
+    mesh.indexType = indexType;
+
+    glGenVertexArrays(1, &mesh.vao);
+    glGenBuffers(1, &mesh.vbo);
+    glGenBuffers(1, &mesh.ibo);
+
+    state.BindVertexArray(mesh.vao);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+    UploadStaticBuffer(GL_ARRAY_BUFFER, vertexCount * 7 * sizeof(float), vertices);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.ibo);
+    UploadStaticBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBytes, indices);
+    renderStats.bufferUploadBytes += vertexCount * 7 * sizeof(float) + indexBytes;
+    Math::BoundingSphere(vertices, vertexCount, 7 * sizeof(float), mesh.boundsCenter, mesh.boundsRadius);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 7 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    state.BindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    mesh.valid = true;
+    return mesh;
 }
 
-Texture Renderer::GetCachedTexture(const std::string& name) {
-    auto it = textureCache.find(name);
-    if (it != textureCache.end()) {
-        return it->second;
+void Renderer::DeleteMesh(GpuMesh& mesh) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { DeleteMesh(mesh); });
+        return;
     }
-    Texture tex = LoadTextureByName(name);
-    if (tex.valid) {
-        textureCache[name] = tex;
+    if (IsFrameInFlight()) {
+        DeferredDelete pending = { DeferredDelete::MESH, frameCounter };
+        pending.mesh = mesh;
+        deferredDeletes.push_back(pending);
+        mesh = GpuMesh();
+        return;
     }
-    return tex;
+    FreeMesh(mesh);
 }
 
-Texture Renderer::CreateTexture(const uint8_t* data, int width, int height, int channels) {
-    Texture tex;
-    tex.width = width;
-    tex.height = height;
-    
-    printf("[CreateTexture] Creating %dx%d texture (%d channels)\n", width, height, channels);
-    
-    glGenTextures(1, &tex.id);
-    glBindTexture(GL_TEXTURE_2D, tex.id);
-    
-    // Alinhamento forçado novamente para garantir
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+void Renderer::FreeMesh(GpuMesh& mesh) {
+    state.ForgetVertexArray(mesh.vao);
+    state.ForgetVertexArray(mesh.instanceVao);
+    if (mesh.vao) glDeleteVertexArrays(1, &mesh.vao);
+    if (mesh.instanceVao) glDeleteVertexArrays(1, &mesh.instanceVao);
+    if (mesh.vbo) glDeleteBuffers(1, &mesh.vbo);
+    if (mesh.ibo) glDeleteBuffers(1, &mesh.ibo);
+    mesh = GpuMesh();
+}
 
-    GLenum format = GL_RGBA;
-    GLenum internalFormat = GL_RGBA;
-
-    if (channels == 4) {
-        format = GL_RGBA;
-    } else if (channels == 3) {
-        format = GL_RGB;
-    } else if (channels == 1) {
-        format = GL_RED;
-        // Se estivermos usando Core Profile moderno, podemos precisar de um Swizzle
-        // para fazer o canal R atuar como Alpha para a fonte
-        GLint swizzleMask[] = {GL_ONE, GL_ONE, GL_ONE, GL_RED};
-        glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+GpuMesh Renderer::GetModelMesh(const ICOBModel& model) {
+    if (model.vertices.empty() || model.indices.empty()) {
+        return GpuMesh();
     }
-    
-    // IMPORTANTE: Usar as dimensões EXATAS passadas, sem padding!
-    printf("[CreateTexture] glTexImage2D(%d, %d, %s)\n", width, height, 
-           channels == 4 ? "RGBA" : channels == 3 ? "RGB" : "RED");
-    
-    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-    
-    // Verifica erros de OpenGL
-    GLenum error = glGetError();
-    if (error != GL_NO_ERROR) {
-        printf("[CreateTexture] OpenGL error: 0x%X\n", error);
+    ModelMesh& entry = modelMeshes[&model];
+    if (entry.mesh.valid && entry.vertexData == model.vertices.data() &&
+        entry.vertexCount == model.vertices.size() && entry.indexCount == model.indices.size()) {
+        return entry.mesh;
     }
-    
-    // Configuração para ficar "Crocante" igual PS2
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR); 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    
-    tex.valid = true;
-    printf("[CreateTexture] Texture created successfully (ID: %u)\n", tex.id);
-    return tex;
+
+    // New model, or one rebuilt in place since the last upload
+    if (entry.mesh.valid) DeleteMesh(entry.mesh);
+    entry.mesh = CreateMesh(model);
+    entry.vertexData = model.vertices.data();
+    entry.vertexCount = model.vertices.size();
+    entry.indexCount = model.indices.size();
+    return entry.mesh;
 }
 
-void Renderer::DeleteTexture(Texture& tex) {
-    if (tex.valid && tex.id) {
-        glDeleteTextures(1, &tex.id);
-        tex.id = 0;
-        tex.valid = false;
+void Renderer::ReleaseModelMesh(const ICOBModel& model) {
+    auto it = modelMeshes.find(&model);
+    if (it == modelMeshes.end()) return;
+    if (it->second.mesh.valid) DeleteMesh(it->second.mesh);
+    modelMeshes.erase(it);
+}
+
+GpuMesh Renderer::GetCachedMesh(const std::string& name) {
+    auto it = meshCache.find(name);
+    if (it != meshCache.end()) {
+        return it->second;
+    }
+
+    if (NeedsInvoke()) {
+        GpuMesh result;
+        renderThread->Invoke([&] { result = GetCachedMesh(name); });
+        return result;
+    }
+
+    // Failed loads are cached too, so a missing icon is not re-read every frame
+    AssetLoader assetLoader;
+    ICOBModel model;
+    GpuMesh mesh;
+    if (assetLoader.LoadICOB(name, model)) {
+        mesh = CreateMesh(model);
+        printf("[Renderer] Uploaded mesh '%s': %zu vertices, %zu indices\n",
+               name.c_str(), model.vertices.size(), model.indices.size());
+    } else {
+        printf("[Renderer] Failed to load mesh: %s\n", name.c_str());
     }
+    meshCache[name] = mesh;
+    return mesh;
 }
 
 // ============================================================================
@@ -910,6 +3245,8 @@ void Renderer::DeleteTexture(Texture& tex) {
 // ============================================================================
 bool Renderer::LoadShaders() {
     printf("[Renderer] Loading shaders...\n");
+    uint64_t start = SDL_GetPerformanceCounter();
+    shaderCache.Init();
     
     // Load basic shader
     std::string vertSource = ReadShaderFile("shaders/basic.vert");
@@ -924,29 +3261,51 @@ bool Renderer::LoadShaders() {
         fragSource = fallbackFragmentShader;
     }
     
-    uint32_t vertShader = CompileShader(vertSource.c_str(), GL_VERTEX_SHADER);
-    if (vertShader == 0) return false;
-    
-    uint32_t fragShader = CompileShader(fragSource.c_str(), GL_FRAGMENT_SHADER);
-    if (fragShader == 0) {
-        glDeleteShader(vertShader);
-        return false;
+    if (!BuildProgram(basicShader, vertSource, fragSource)) return false;
+
+    // Load instanced shader (shares basic.frag; optional, draws fall back to one call per instance)
+    std::string instVertSource = ReadShaderFile("shaders/instanced.vert");
+    if (instVertSource.empty()) {
+        printf("[Renderer] Using fallback instanced vertex shader\n");
+        instVertSource = fallbackInstancedVertShader;
     }
     
-    basicShader.id = glCreateProgram();
-    glAttachShader(basicShader.id, vertShader);
-    glAttachShader(basicShader.id, fragShader);
-    
-    if (!LinkProgram(basicShader.id)) {
-        glDeleteShader(vertShader);
-        glDeleteShader(fragShader);
-        glDeleteProgram(basicShader.id);
-        return false;
+    BuildProgram(instancedShader, instVertSource, fragSource);
+    if (!instancedShader.valid) {
+        printf("[Renderer] Warning: Instanced shader failed, instancing disabled\n");
+    }
+
+    // Load post-processing shader (optional, the frame is blitted without it)
+    std::string postVertSource = ReadShaderFile("shaders/postfx.vert");
+    std::string postFragSource = ReadShaderFile("shaders/postfx.frag");
+    if (postVertSource.empty()) {
+        printf("[Renderer] Using fallback postfx vertex shader\n");
+        postVertSource = fallbackPostFxVertShader;
+    }
+    if (postFragSource.empty()) {
+        printf("[Renderer] Using fallback postfx fragment shader\n");
+        postFragSource = fallbackPostFxFragShader;
+    }
+
+    if (!BuildProgram(postFxShader, postVertSource, postFragSource)) {
+        printf("[Renderer] Warning: Postfx shader failed, frames are blitted without post effects\n");
+    }
+
+    // Load bloom shaders (fullscreen triangle from postfx.vert)
+    std::string bloomDownSource = ReadShaderFile("shaders/bloom_down.frag");
+    std::string bloomUpSource = ReadShaderFile("shaders/bloom_up.frag");
+    if (bloomDownSource.empty()) {
+        printf("[Renderer] Using fallback bloom downsample shader\n");
+        bloomDownSource = fallbackBloomDownFragShader;
+    }
+    if (bloomUpSource.empty()) {
+        printf("[Renderer] Using fallback bloom upsample shader\n");
+        bloomUpSource = fallbackBloomUpFragShader;
+    }
+    if (!BuildProgram(bloomDownShader, postVertSource, bloomDownSource) ||
+        !BuildProgram(bloomUpShader, postVertSource, bloomUpSource)) {
+        printf("[Renderer] Warning: Bloom shaders failed, bloom disabled\n");
     }
-    
-    glDeleteShader(vertShader);
-    glDeleteShader(fragShader);
-    basicShader.valid = true;
 
     // Load text shader
     std::string textVertSource = ReadShaderFile("shaders/text.vert");
@@ -961,34 +3320,9 @@ bool Renderer::LoadShaders() {
         textFragSource = fallbackTextFragShader;
     }
     
-    uint32_t textVertShader = CompileShader(textVertSource.c_str(), GL_VERTEX_SHADER);
-    if (textVertShader == 0) {
-        printf("[Renderer] Warning: Text vertex shader failed, text rendering disabled\n");
-        return true; // Continue without text
-    }
-    
-    uint32_t textFragShader = CompileShader(textFragSource.c_str(), GL_FRAGMENT_SHADER);
-    if (textFragShader == 0) {
-        glDeleteShader(textVertShader);
-        printf("[Renderer] Warning: Text fragment shader failed, text rendering disabled\n");
-        return true;
-    }
-    
-    textShader.id = glCreateProgram();
-    glAttachShader(textShader.id, textVertShader);
-    glAttachShader(textShader.id, textFragShader);
-    
-    if (!LinkProgram(textShader.id)) {
-        glDeleteShader(textVertShader);
-        glDeleteShader(textFragShader);
-        glDeleteProgram(textShader.id);
-        printf("[Renderer] Warning: Text shader link failed\n");
-        return true;
+    if (!BuildProgram(textShader, textVertSource, textFragSource)) {
+        printf("[Renderer] Warning: Text shader failed, text rendering disabled\n");
     }
-    
-    glDeleteShader(textVertShader);
-    glDeleteShader(textFragShader);
-    textShader.valid = true;
 
     // Load sprite shader
     std::string spriteVertSource = ReadShaderFile("shaders/sprite.vert");
@@ -1003,36 +3337,64 @@ bool Renderer::LoadShaders() {
         spriteFragSource = fallbackSpriteFragShader;
     }
     
-    uint32_t spriteVertShader = CompileShader(spriteVertSource.c_str(), GL_VERTEX_SHADER);
-    if (spriteVertShader == 0) {
-        printf("[Renderer] Warning: Sprite vertex shader failed\n");
-        return true;
+    if (!BuildProgram(spriteShader, spriteVertSource, spriteFragSource)) {
+        printf("[Renderer] Warning: Sprite shader failed, rects drawn with the basic shader\n");
     }
-    
-    uint32_t spriteFragShader = CompileShader(spriteFragSource.c_str(), GL_FRAGMENT_SHADER);
-    if (spriteFragShader == 0) {
-        glDeleteShader(spriteVertShader);
-        printf("[Renderer] Warning: Sprite fragment shader failed\n");
-        return true;
+
+    // Load GS sprite shader (raw swizzled textures, same vertex stage as sprites)
+    std::string gsSpriteSource = ReadShaderFile("shaders/gs_sprite.frag");
+    if (gsSpriteSource.empty()) {
+        printf("[Renderer] Using fallback GS sprite fragment shader\n");
+        gsSpriteSource = fallbackGsSpriteFragShader;
     }
-    
-    spriteShader.id = glCreateProgram();
-    glAttachShader(spriteShader.id, spriteVertShader);
-    glAttachShader(spriteShader.id, spriteFragShader);
-    
-    if (!LinkProgram(spriteShader.id)) {
-        glDeleteShader(spriteVertShader);
-        glDeleteShader(spriteFragShader);
-        glDeleteProgram(spriteShader.id);
-        printf("[Renderer] Warning: Sprite shader link failed\n");
+    if (!BuildProgram(gsSpriteShader, spriteVertSource, gsSpriteSource)) {
+        printf("[Renderer] Warning: GS sprite shader failed, raw GS textures disabled\n");
+    }
+
+    double ms = (SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+    printf("[Renderer] Shaders loaded in %.1f ms (%d cached, %d compiled)\n",
+           ms, shaderCache.GetHits(), shaderCache.GetMisses());
+    return true;
+}
+
+bool Renderer::BuildProgram(Shader& shader, const std::string& vertSource, const std::string& fragSource) {
+    // A binary linked on an earlier run skips compilation entirely
+    uint64_t key = shaderCache.MakeKey(vertSource, fragSource);
+    shader.id = glCreateProgram();
+    if (shaderCache.Load(key, shader.id)) {
+        shader.Reflect();
+        shader.valid = true;
         return true;
     }
-    
-    glDeleteShader(spriteVertShader);
-    glDeleteShader(spriteFragShader);
-    spriteShader.valid = true;
+    glDeleteProgram(shader.id);
+    shader.id = 0;
+
+    uint32_t vertShader = CompileShader(vertSource.c_str(), GL_VERTEX_SHADER);
+    if (vertShader == 0) return false;
+
+    uint32_t fragShader = CompileShader(fragSource.c_str(), GL_FRAGMENT_SHADER);
+    if (fragShader == 0) {
+        glDeleteShader(vertShader);
+        return false;
+    }
+
+    shader.id = glCreateProgram();
+    glAttachShader(shader.id, vertShader);
+    glAttachShader(shader.id, fragShader);
+    shaderCache.PrepareProgram(shader.id);
+    bool linked = LinkProgram(shader.id);
+    glDeleteShader(vertShader);
+    glDeleteShader(fragShader);
 
-    printf("[Renderer] All shaders loaded successfully\n");
+    if (!linked) {
+        glDeleteProgram(shader.id);
+        shader.id = 0;
+        return false;
+    }
+
+    shaderCache.Store(key, shader.id);
+    shader.Reflect();
+    shader.valid = true;
     return true;
 }
 
@@ -1080,7 +3442,36 @@ bool Renderer::LinkProgram(uint32_t program) {
     return true;
 }
 
+// ============================================================================
+// Stream Helpers
+// ============================================================================
+int Renderer::PushVertices(const void* data, size_t count, size_t stride) {
+    // Align to the vertex stride so the offset maps to a whole base vertex
+    size_t offset = vertexStream.Push(data, count * stride, stride);
+    if (offset == SIZE_MAX) {
+        printf("[Renderer] Vertex stream push failed (%zu bytes)\n", count * stride);
+        return -1;
+    }
+    renderStats.bufferUploadBytes += count * stride;
+    return (int)(offset / stride);
+}
+
+size_t Renderer::PushIndices(const void* data, size_t bytes) {
+    size_t offset = indexStream.Push(data, bytes, sizeof(uint32_t));
+    if (offset == SIZE_MAX) {
+        printf("[Renderer] Index stream push failed (%zu bytes)\n", bytes);
+    } else {
+        renderStats.bufferUploadBytes += bytes;
+    }
+    return offset;
+}
+
 Shader Renderer::LoadShader(const std::string& vertPath, const std::string& fragPath) {
+    if (NeedsInvoke()) {
+        Shader result;
+        renderThread->Invoke([&] { result = LoadShader(vertPath, fragPath); });
+        return result;
+    }
     Shader shader;
     
     std::string vertSource = ReadShaderFile(vertPath);
@@ -1114,12 +3505,18 @@ Shader Renderer::LoadShader(const std::string& vertPath, const std::string& frag
     glDeleteShader(vertShader);
     glDeleteShader(fragShader);
     
+    shader.Reflect();
     shader.valid = true;
     return shader;
 }
 
 void Renderer::DeleteShader(Shader& shader) {
+    if (NeedsInvoke()) {
+        renderThread->Invoke([&] { DeleteShader(shader); });
+        return;
+    }
     if (shader.valid && shader.id) {
+        state.ForgetProgram(shader.id);
         glDeleteProgram(shader.id);
         shader.id = 0;
         shader.valid = false;
@@ -1129,24 +3526,34 @@ void Renderer::DeleteShader(Shader& shader) {
 // ============================================================================
 // State Management
 // ============================================================================
+// Blend and depth are applied lazily by the next 3D draw (see Apply3DState)
 void Renderer::SetBlendMode(bool additive) {
-    if (additive) {
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE);
-    } else {
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    if (recordTarget) {
+        recordState.additive = additive;
+        recordStateDirty = true;
+        return;
     }
+    additiveBlend = additive;
 }
 
 void Renderer::SetDepthTest(bool enabled) {
-    if (enabled) {
-        glEnable(GL_DEPTH_TEST);
-    } else {
-        glDisable(GL_DEPTH_TEST);
+    if (recordTarget) {
+        recordState.depthTest = enabled;
+        recordStateDirty = true;
+        return;
     }
+    depthTest3D = enabled;
 }
 
 void Renderer::SetWireframe(bool enabled) {
+    if (recordTarget) {
+        recordState.wireframe = enabled;
+        recordStateDirty = true;
+        return;
+    }
+    FlushQuads();
     glPolygonMode(GL_FRONT_AND_BACK, enabled ? GL_LINE : GL_FILL);
+    wireframe = enabled;
 }
 
 // ============================================================================
@@ -1207,6 +3614,48 @@ void Renderer::MultiplyMatrices(float* result, const float* a, const float* b) {
     }
 }
 
+void Renderer::SetModelMatrix(float* matrix, const Vec3& position, const Vec3& scale, const Vec3& rotation) {
+    float cosX = cosf(rotation.x), sinX = sinf(rotation.x);
+    float cosY = cosf(rotation.y), sinY = sinf(rotation.y);
+    float cosZ = cosf(rotation.z), sinZ = sinf(rotation.z);
+
+    // Each column is a scaled basis vector run through the rotation
+    // order scenes were authored for: Y, then X, then Z
+    const float basis[3][3] = {
+        { scale.x, 0.0f, 0.0f },
+        { 0.0f, scale.y, 0.0f },
+        { 0.0f, 0.0f, scale.z }
+    };
+
+    for (int c = 0; c < 3; c++) {
+        float x = basis[c][0];
+        float y = basis[c][1];
+        float z = basis[c][2];
+
+        float xr = x * cosY + z * sinY;
+        float zr = -x * sinY + z * cosY;
+        x = xr; z = zr;
+
+        float yr = y * cosX - z * sinX;
+        zr = y * sinX + z * cosX;
+        y = yr; z = zr;
+
+        xr = x * cosZ - y * sinZ;
+        yr = x * sinZ + y * cosZ;
+        x = xr; y = yr;
+
+        matrix[c * 4 + 0] = x;
+        matrix[c * 4 + 1] = y;
+        matrix[c * 4 + 2] = z;
+        matrix[c * 4 + 3] = 0.0f;
+    }
+
+    matrix[12] = position.x;
+    matrix[13] = position.y;
+    matrix[14] = position.z;
+    matrix[15] = 1.0f;
+}
+
 // ============================================================================
 // Geometry Helpers
 // ============================================================================
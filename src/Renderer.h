@@ -9,6 +9,13 @@
 #include "MathTypes.h"
 #include "FontLoader.h"
 #include "TextureLoader.h"
+#include "TextureAtlas.h"
+#include "CommandList.h"
+#include "GpuProfiler.h"
+#include "ShaderCache.h"
+#include <atomic>
+#include <list>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #ifdef DrawText
@@ -16,6 +23,7 @@
 #endif
 
 struct ICOBModel;
+class RenderThread;
 
 // ============================================================================
 // Texture - OpenGL texture wrapper
@@ -24,29 +32,271 @@ struct Texture {
     uint32_t id = 0;
     int width = 0;
     int height = 0;
+    int channels = 0;       // Pool bucket (see CreateTexture)
     bool valid = false;
+
+    // Sub-rect of id; atlas entries share their page texture with other assets
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    bool atlased = false;
     
     void Bind(uint32_t unit = 0) const;
     void Unbind() const;
 };
 
+// ============================================================================
+// GsTexture - GS texture kept in its native layout (swizzled, 4..32 bpp)
+// Decoded per fragment by gs_sprite.frag instead of expanded to RGBA on load
+// ============================================================================
+struct GsTexture {
+    static constexpr int DATA_WIDTH = 256;  // Payload texels per row
+
+    uint32_t id = 0;        // R32UI (PSM32), R16UI (PSM16) or R8UI payload
+    uint32_t clut = 0;      // 256x1 RGBA8, 0 = indexed formats are alpha masks
+    int width = 0;
+    int height = 0;
+    int psm = 0;            // PS2_PSM
+    bool valid = false;
+};
+
+// ============================================================================
+// TextLayout - A string broken into lines, glyph quads placed at the origin
+// and left aligned. Position, alignment and color are applied when drawn, so
+// one layout serves every place the same (text, scale, wrap width) appears
+// ============================================================================
+enum class TextAlign : uint8_t { Left, Center, Right };
+
+struct TextBounds {
+    float width = 0.0f;     // Widest line (trailing spaces excluded)
+    float height = 0.0f;
+    int lines = 0;
+};
+
+struct TextLayout {
+    struct Line {
+        uint32_t firstQuad;
+        uint32_t quadCount;
+        float width;
+    };
+    std::vector<float> vertices;    // 54 floats per glyph (pos.xy + tex.uvw + color.rgba)
+    std::vector<Line> lines;
+    TextBounds bounds;
+};
+
+// ============================================================================
+// TextMesh - Retained string
+// Glyph quads are laid out once by Renderer::SetTextMesh and only redone when
+// the text or scale change; position and color are applied when drawn
+// ============================================================================
+struct TextMesh {
+    std::string text;
+    float x = 0.0f;
+    float y = 0.0f;
+    float scale = 1.0f;
+    Color color;
+    TextLayout layout;
+    bool laidOut = false;
+};
+
+// ============================================================================
+// TextureCacheStats - Residency of the named texture cache (GetCachedTexture)
+// ============================================================================
+struct TextureCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t residentBytes = 0;   // Cached textures + atlas pages + font
+    size_t pinnedBytes = 0;     // Part of residentBytes that is never evicted
+    size_t pooledBytes = 0;     // Released storage kept for reuse (not resident)
+    size_t budgetBytes = 0;
+    int entries = 0;
+};
+
+// ============================================================================
+// RenderTarget - Framebuffer object with color texture + depth renderbuffer
+// ============================================================================
+struct RenderTarget {
+    uint32_t fbo = 0;
+    uint32_t colorTex = 0;
+    uint32_t depthRb = 0;
+    int width = 0;
+    int height = 0;
+    bool valid = false;
+};
+
+// Upscale from the internal resolution to the output (postfx.frag)
+enum class UpscaleFilter {
+    Nearest,
+    SharpBilinear
+};
+
+// ============================================================================
+// FrameUniforms - std140 mirror of the FrameUniforms block in the shaders
+// Uploaded only when camera/projection/fog/time change
+// ============================================================================
+struct FrameUniforms {
+    static constexpr uint32_t BINDING = 0;
+
+    float projection[16];
+    float view[16];
+    float ortho[16];
+    float fogColor[3];
+    float fogDensity;
+    float viewPos[3];
+    float time;
+};
+static_assert(sizeof(FrameUniforms) == 224, "FrameUniforms must match the std140 block layout");
+
 // ============================================================================
 // Shader - OpenGL shader program wrapper
+// Uniform locations are reflected once after linking
 // ============================================================================
 struct Shader {
     uint32_t id = 0;
     bool valid = false;
+    std::unordered_map<std::string, int> locations;
     
+    void Reflect();     // Cache uniform locations, bind the FrameUniforms block
+    int Location(const char* name) const;
     void Use() const;
     void SetInt(const char* name, int value) const;
     void SetFloat(const char* name, float value) const;
     void SetVec3(const char* name, const Vec3& value) const;
     void SetVec3(const char* name, float x, float y, float z) const;
+    void SetVec2(const char* name, float x, float y) const;
+    void SetIVec2(const char* name, int x, int y) const;
     void SetVec4(const char* name, float x, float y, float z, float w) const;
     void SetMat4(const char* name, const float* matrix) const;
     void SetBool(const char* name, bool value) const;
 };
 
+// ============================================================================
+// GpuMesh - Static mesh resident on the GPU
+// Uploaded once (pos.xyz + color.rgba), drawn with a model matrix and tint
+// ============================================================================
+struct GpuMesh {
+    uint32_t vao = 0;
+    uint32_t vbo = 0;
+    uint32_t ibo = 0;
+    int vertexCount = 0;
+    int indexCount = 0;
+    uint32_t indexType = 0;  // GL_UNSIGNED_SHORT / GL_UNSIGNED_INT
+    uint32_t instanceVao = 0; // Created on first instanced draw
+    Vec3 boundsCenter;        // Model-space bounding sphere (culling)
+    float boundsRadius = 0.0f;
+    bool valid = false;
+};
+
+// ============================================================================
+// InstanceData - Per-instance transform and color for instanced primitives
+// Spheres use scale.x as the radius (scale.y/z are ignored)
+// ============================================================================
+struct InstanceData {
+    Vec3 position;
+    Vec3 scale = Vec3(1.0f);
+    Vec3 rotation;
+    Color color;
+};
+
+// ============================================================================
+// StreamBuffer - Fenced ring buffer for per-frame vertex/index data
+// Persistently mapped when ARB_buffer_storage is available, otherwise written
+// through unsynchronized glMapBufferRange. The ring is split into segments: a
+// fence is inserted when the write head leaves a segment and waited on before
+// the head enters it again, so data still in flight is never overwritten.
+// ============================================================================
+struct StreamBuffer {
+    static constexpr int SEGMENT_COUNT = 4;
+
+    uint32_t id = 0;
+    size_t size = 0;
+    size_t head = 0;
+    int segment = 0;
+    uint8_t* mapped = nullptr;          // Persistent mapping (null when unsupported)
+    void* fences[SEGMENT_COUNT] = {};   // GLsync per segment
+
+    bool Create(size_t bytes);
+    void Destroy();
+
+    // Copies data into the ring, returns its byte offset (SIZE_MAX on failure).
+    // A single push may not exceed one segment (size / SEGMENT_COUNT).
+    size_t Push(const void* data, size_t bytes, size_t alignment);
+};
+
+// ============================================================================
+// RenderState - Shadow copy of the GL state the renderer touches
+// Calls that would not change anything are skipped and counted as elided.
+// After Invalidate() every value is unknown and the next call goes through.
+// ============================================================================
+struct RenderState {
+    static constexpr int TEXTURE_UNITS = 8;
+
+    uint32_t program;
+    uint32_t vao;
+    uint32_t activeUnit;
+    uint32_t textures[TEXTURE_UNITS];
+    uint32_t textureArrays[TEXTURE_UNITS];  // GL_TEXTURE_2D_ARRAY, tracked separately
+    int blend;              // -1 unknown, 0 off, 1 on
+    int depthTest;
+    int cullFace;
+    uint32_t blendSrc;
+    uint32_t blendDst;
+    float lineWidth;
+
+    int issued = 0;         // GL calls made this frame
+    int elided = 0;         // GL calls skipped this frame
+    int textureBinds = 0;   // glBindTexture calls among the issued ones
+    int programSwitches = 0;
+
+    RenderState() { Invalidate(); }
+
+    void Invalidate();
+    void UseProgram(uint32_t id);
+    void BindVertexArray(uint32_t id);
+    void BindTexture(uint32_t unit, uint32_t id);
+    void BindTextureArray(uint32_t unit, uint32_t id);
+    void SetBlend(bool enabled);
+    void SetBlendFunc(uint32_t src, uint32_t dst);
+    void SetDepthTest(bool enabled);
+    void SetCullFace(bool enabled);
+    void SetLineWidth(float width);
+
+    // Objects deleted behind the shadow's back (GL rebinds 0 when a bound one dies)
+    void ForgetProgram(uint32_t id);
+    void ForgetVertexArray(uint32_t id);
+    void ForgetTexture(uint32_t id);
+};
+
+// ============================================================================
+// RenderStats - Per-frame renderer counters
+// Draw counters restart in BeginFrame. Resource counters (uploads, textures
+// created/deleted) run from one EndFrame to the next, so loads done during
+// Update land in the frame that follows. EndFrame latches both. Draws made
+// by the debug overlays are left out (their uploads and binds are not).
+// ============================================================================
+struct RenderStats {
+    enum Primitive { PRIM_TRIANGLES, PRIM_LINES, PRIM_POINTS, PRIM_COUNT };
+
+    int drawCalls = 0;
+    int drawCallsByPrimitive[PRIM_COUNT] = {};
+    int quadBatches = 0;            // 2D batches (included in drawCalls)
+    uint64_t vertices = 0;          // Vertices read by draws, times instances
+    uint64_t indices = 0;           // Indices submitted, times instances
+    uint64_t instances = 0;         // Instanced draws only
+    int culledDraws = 0;            // Rejected by frustum/fog culling before any vertex work
+    uint64_t culledInstances = 0;
+    int textureBinds = 0;           // Issued after state shadowing
+    int programSwitches = 0;
+    int stateCallsIssued = 0;       // All RenderState calls
+    int stateCallsElided = 0;
+
+    size_t bufferUploadBytes = 0;   // Vertex/index streams, uniform buffer, static meshes
+    size_t textureUploadBytes = 0;
+    int texturesCreated = 0;
+    int texturesDeleted = 0;
+
+    void ResetDraws();
+};
+
 // ============================================================================
 // Renderer - Main rendering class
 // ============================================================================
@@ -61,43 +311,127 @@ public:
     // Frame management
     void BeginFrame();
     void EndFrame();
+
+    // Command recording: draw and state calls made on the recording thread go
+    // into the list instead of GL; Execute sorts and replays it on the GL thread
+    void BeginRecording(CommandList& list);
+    void EndRecording();
+    bool IsRecording() const { return recordTarget != nullptr; }
+    void Execute(CommandList& list);
+
+    // While set, resource calls from other threads are run on the render thread
+    void SetRenderThread(RenderThread* thread) { renderThread = thread; }
     
     // Camera/View
     void SetCamera(const Vec3& position, const Vec3& target, const Vec3& up = Vec3(0,1,0));
     void SetProjection(float fov, float aspect, float nearPlane, float farPlane);
     void SetOrtho(float left, float right, float bottom, float top, float nearPlane, float farPlane);
+    void SetTime(float seconds);    // Exposed to shaders as uTime
+    void SetProfileScope(const char* scope);  // Profiler key prefix (scene name, static string)
 
     // Fog control (PS2 style exponential fog)
     void SetFog(float density, const Vec3& color);
     void DisableFog();
+    // Opt-in: also cull 3D draws whose nearest point is fogged below threshold
+    // (exp(-density * d) < threshold). Only invisible if the background there
+    // is the fog color, hence off by default. Frustum culling is always on
+    void SetFogCulling(bool enabled, float threshold = 1.0f / 255.0f);
 
     // 3D Drawing
     void DrawCube(const Vec3& position, const Vec3& scale, const Color& color, const Vec3& rotation = Vec3(0,0,0));
     void DrawMesh(const ICOBModel& mesh, const Vec3& position, const Vec3& scale, const Color& color, const Vec3& rotation = Vec3(0,0,0));
-    void DrawSphere(const Vec3& position, float radius, const Color& color, int segments = 16);
+    void DrawMesh(const GpuMesh& mesh, const Vec3& position, const Vec3& scale, const Color& color, const Vec3& rotation = Vec3(0,0,0));
+    void DrawSphere(const Vec3& position, float radius, const Color& color, int segments = 0);  // 0 = auto LOD, >0 = LOD cap
+
+    // Instanced 3D Drawing (one draw call per batch against cached unit geometry)
+    void DrawCubesInstanced(const InstanceData* instances, size_t count);
+    void DrawSpheresInstanced(const InstanceData* instances, size_t count, int segments = 0);
 
     // 2D Drawing (screen-space, PS2 resolution 640x448)
     void DrawLine(const Vec3& start, const Vec3& end, const Color& color, float width = 1.0f);
     void DrawRect(float x, float y, float w, float h, const Color& color);
     void DrawSprite(const Texture& tex, float x, float y, float w, float h, const Color& tint = Color(1.0f,1.0f,1.0f,1.0f));
     void DrawSprite(const std::string& texName, float x, float y, float w, float h, const Color& tint = Color(1.0f,1.0f,1.0f,1.0f));
+    void DrawSprite(const GsTexture& tex, float x, float y, float w, float h, const Color& tint = Color(1.0f,1.0f,1.0f,1.0f));
     
-    // Text rendering (uses FNTASCII bitmap font)
+    // Text rendering (UTF-8; Shift-JIS save titles go through TextCodec::ShiftJisToUtf8).
+    // OSD icons are U+E000 + cell (FNTEXOSD) and U+E100 + cell (FNTADD00)
     void DrawText(const char* text, float x, float y, const Color& color, float scale = 1.0f);
+    // Wrapped at width (0 = only at '\n'), each line aligned inside [x, x + width]
+    void DrawTextBox(const char* text, float x, float y, float width, TextAlign align,
+                     const Color& color, float scale = 1.0f);
     float GetTextWidth(const char* text, float scale = 1.0f);
+    TextBounds MeasureText(const char* text, float scale = 1.0f, float wrapWidth = 0.0f);
+
+    // Retained text for static labels (layout reused across frames)
+    void SetTextMesh(TextMesh& mesh, const char* text, float x, float y, const Color& color, float scale = 1.0f);
+    void DrawTextMesh(const TextMesh& mesh);
     bool IsFontLoaded() const { return fontLoaded; }
 
     // Debug
     void DrawDebugGrid(float size = 100.0f, int divisions = 10);
     void DrawDebugAxis(float length = 50.0f);
 
+    // Profiling (GPU timer queries per pass + CPU timers, see GpuProfiler)
+    GpuProfiler& GetProfiler() { return profiler; }
+    void SetProfilerOverlay(bool visible) { profilerOverlay = visible; }
+    bool IsProfilerOverlayVisible() const { return profilerOverlay; }
+
+    // Counters of the last completed frame (any thread, see RenderStats)
+    RenderStats GetRenderStats() const;
+    void SetStatsOverlay(bool visible) { statsOverlay = visible; }
+    bool IsStatsOverlayVisible() const { return statsOverlay; }
+
     // Texture management
     Texture LoadTexture(const std::string& path);
     Texture LoadTextureByName(const std::string& name);  // Load from assets/textures/NAME.bin
     Texture CreateTexture(const uint8_t* data, int width, int height, int channels);
     void DeleteTexture(Texture& tex);
-    Texture GetCachedTexture(const std::string& name);   // Get from cache or load
+    Texture GetCachedTexture(const std::string& name);   // Get from cache or load, scene-pinned
+
+    // Texture cache budget: least recently used entries idle for at least
+    // minIdleFrames are evicted once resident bytes would exceed it. Every
+    // texture fetched since the last scene change is scene-pinned, so only
+    // earlier scenes' textures are candidates
+    void SetTextureCacheBudget(size_t bytes, int minIdleFrames = 4);
+    void PinTexture(const std::string& name);            // Never evicted (loads it if needed)
+    void PinSceneTexture(const std::string& name);       // Preload, pinned until ReleaseSceneTextures
+    void ReleaseSceneTextures();                         // Scene change: drop scene pins
+    TextureCacheStats GetTextureCacheStats() const;
+
+    // Raw GS textures (uploaded swizzled, unswizzle + CLUT done in the shader)
+    GsTexture CreateGsTexture(const GsRawData& raw);
+    GsTexture LoadGsTexture(const std::string& name);    // assets/textures/NAME.bin
+    void DeleteGsTexture(GsTexture& tex);   // Freed once queued frames using it have replayed
     
+    // Mesh management
+    GpuMesh CreateMesh(const ICOBModel& model);
+    void DeleteMesh(GpuMesh& mesh);         // Freed once queued frames using it have replayed
+    GpuMesh GetCachedMesh(const std::string& name);    // Load ICOB from assets/icons/NAME.bin once
+    // DrawMesh(const ICOBModel&) keeps an upload per model address; owners call
+    // this before destroying the model so the mesh is freed and the address reusable
+    void ReleaseModelMesh(const ICOBModel& model);
+
+    // Render targets
+    RenderTarget CreateRenderTarget(int width, int height, bool depth = true);
+    void DeleteRenderTarget(RenderTarget& target);
+
+    // Internal resolution: frames are drawn into a target of this size, then
+    // one postfx pass dithers and upscales it (letterboxed) to the output
+    void SetInternalResolution(int width, int height);
+    int GetInternalWidth() const { return internalWidth; }
+    int GetInternalHeight() const { return internalHeight; }
+    // Setters below apply on the GL thread, between frames
+    void SetOutputSize(int width, int height);              // Window drawable size
+    void SetOutputTarget(const RenderTarget* target);       // Offscreen output; nullptr = window
+    void SetUpscaleFilter(UpscaleFilter filter);
+    UpscaleFilter GetUpscaleFilter() const { return upscaleFilter; }
+
+    // Bloom (bright-pass + half-resolution down/up chain, composited in postfx)
+    void SetBloom(bool enabled, float intensity = 0.8f, float threshold = 0.75f);
+    bool IsBloomEnabled() const { return bloomEnabled; }
+    bool IsBloomActive() const;     // Enabled and the chain can actually run (shaders, targets)
+
     // Shader management
     Shader LoadShader(const std::string& vertPath, const std::string& fragPath);
     void DeleteShader(Shader& shader);
@@ -108,16 +442,97 @@ public:
     void SetWireframe(bool enabled);
 
 private:
-    // OpenGL handles
-    uint32_t vao = 0;
-    uint32_t vbo = 0;
-    uint32_t ebo = 0;
-    
-    // Text rendering VAO/VBO
-    uint32_t textVao = 0;
-    uint32_t textVbo = 0;
+    // Streaming geometry (all per-frame vertex/index data lives here)
+    static constexpr size_t VERTEX_STREAM_SIZE = 4 * 1024 * 1024;
+    static constexpr size_t INDEX_STREAM_SIZE = 1024 * 1024;
+    StreamBuffer vertexStream;
+    StreamBuffer indexStream;
+
+    // Texture uploads are staged here and copied with glTexSubImage2D from
+    // the buffer (GL_PIXEL_UNPACK_BUFFER), so the call never waits on the GPU
+    static constexpr size_t UPLOAD_STREAM_SIZE = 8 * 1024 * 1024;
+    StreamBuffer uploadStream;
+
+    // Per-vertex-format VAOs (created once, bound to the streams)
+    uint32_t vao = 0;       // pos.xyz + color.rgba (7 floats)
+    uint32_t textVao = 0;   // pos.xy + tex.uv + color.rgba (8 floats)
+    uint32_t glyphVao = 0;  // pos.xy + tex.uv + layer + color.rgba (9 floats)
     
-    // Shaders
+    // 2D quad batch (pos.xy + tex.uv + color.rgba, 6 vertices per quad;
+    // text batches carry the glyph layer too, see GLYPH_QUAD_FLOATS)
+    static constexpr size_t MAX_BATCH_QUADS = 4096;
+    static constexpr size_t GLYPH_QUAD_FLOATS = 54;
+    std::vector<float> quadVertices;
+    const Shader* quadShader = nullptr;
+    uint32_t quadTexture = 0;
+    GsTexture quadGsTexture;    // Format/CLUT of the batch when quadShader is gsSpriteShader
+    bool quadAdditive = false;
+    bool additiveBlend = false;
+    bool depthTest3D = true;
+    bool wireframe = false;
+
+    // Command recording (per thread, so replay on the GL thread never records)
+    static thread_local CommandList* recordTarget;
+    StateBlock recordState;
+    bool recordStateDirty = true;
+    RenderThread* renderThread = nullptr;
+
+    // Frame numbers: frameCounter advances on the thread that builds frames
+    // (BeginRecording, or BeginFrame when drawing directly); completedFrame is
+    // the last one whose draws have all executed on the GL thread
+    std::atomic<uint64_t> frameCounter{0};
+    std::atomic<uint64_t> completedFrame{0};
+    uint64_t replayFrame = 0;       // GL thread: frame being executed
+
+    // Deletes requested while recorded frames are still queued wait here until
+    // every frame recorded up to the request has replayed
+    struct DeferredDelete {
+        enum Kind : uint8_t { TEXTURE, GS_TEXTURE, MESH } kind;
+        uint64_t frame;
+        Texture texture;
+        GsTexture gsTexture;
+        GpuMesh mesh;
+    };
+    std::vector<DeferredDelete> deferredDeletes;
+
+    // Profiler (passes are GPU regions; switched as draws change type)
+    GpuProfiler profiler;
+    const char* currentPass = nullptr;
+    std::atomic<bool> profilerOverlay{false};
+    bool drawingOverlay = false;
+
+    // Frame counters (GL thread); the latched copy is read from any thread
+    RenderStats renderStats;
+    RenderStats lastRenderStats;
+    mutable std::mutex renderStatsMutex;
+    std::atomic<bool> statsOverlay{false};
+
+    // Internal resolution target + post pass
+    RenderTarget sceneTarget;
+    int internalWidth = 640;
+    int internalHeight = 448;
+    std::atomic<int> outputWidth{0};
+    std::atomic<int> outputHeight{0};
+    const RenderTarget* outputTarget = nullptr;
+    std::atomic<UpscaleFilter> upscaleFilter{UpscaleFilter::SharpBilinear};
+    Shader postFxShader;
+    uint32_t postVao = 0;
+
+    // Bloom chain (level 0 = half internal resolution)
+    static constexpr int BLOOM_LEVELS = 5;
+    RenderTarget bloomTargets[BLOOM_LEVELS];
+    int bloomLevelCount = 0;
+    std::atomic<bool> bloomEnabled{true};
+    std::atomic<float> bloomIntensity{0.8f};
+    std::atomic<float> bloomThreshold{0.75f};
+    Shader bloomDownShader;
+    Shader bloomUpShader;
+
+    // GL state shadow (invalidated every BeginFrame)
+    RenderState state;
+
+    // Shaders (linked binaries persisted across runs)
+    ShaderCache shaderCache;
     Shader basicShader;
     Shader textShader;
     
@@ -126,28 +541,133 @@ private:
     float viewMatrix[16];
     float orthoMatrix[16];
     Vec3 cameraPosition;
+    float frameTime = 0.0f;
+
+    // Per-frame uniform block (shared by all programs)
+    uint32_t frameUbo = 0;
+    bool frameUniformsDirty = true;
 
     // Fog state
     bool fogEnabled = false;
     float fogDensity = 0.05f;
     Vec3 fogColor = Vec3(0.05f, 0.05f, 0.1f);
+    float fogCullThreshold = 0.0f;      // 0 = fog culling off
+
+    // View frustum planes (xyz normal, w distance; inside is positive),
+    // rebuilt from projection * view on first use after a change
+    float frustumPlanes[6][4];
+    bool frustumDirty = true;
+
+    // Immediate-mode text: layouts of recently drawn or measured strings, most
+    // recent first, keyed on text + scale + wrap width. Scenes measure on the
+    // main thread while the render thread draws, hence the mutex
+    struct CachedTextLayout {
+        uint64_t hash;
+        std::string text;
+        float scale, wrapWidth;
+        TextLayout layout;
+    };
+    std::mutex textLayoutMutex;
+    static constexpr size_t TEXT_LAYOUT_CACHE_SIZE = 256;
+    std::list<CachedTextLayout> textLayouts;
+    std::unordered_map<uint64_t, std::list<CachedTextLayout>::iterator> textLayoutIndex;
 
     // Font system
+    // All bitmap banks live in one GL_TEXTURE_2D_ARRAY (one layer per bank),
+    // so mixed ASCII / kana / kanji / icon strings stay a single draw
     FontLoader fontLoader;
-    Texture fontTexture;
+    GlyphTable glyphTable;
+    uint32_t glyphArray = 0;
+    size_t glyphArrayBytes = 0;
     bool fontLoaded = false;
 
     // Texture system
     TextureLoader textureLoader;
-    std::unordered_map<std::string, Texture> textureCache;
+    enum TexturePin : uint8_t { PIN_NONE, PIN_SCENE, PIN_ALWAYS };
+    struct CachedTexture {
+        Texture texture;
+        size_t bytes = 0;           // 0 for atlas entries (their page is counted once)
+        uint64_t lastUsedFrame = 0;
+        TexturePin pin = PIN_NONE;
+    };
+    std::unordered_map<std::string, CachedTexture> textureCache;
+    TextureCacheStats textureCacheStats;
+    size_t textureCacheBytes = 0;   // Evictable + pinned entries (atlas/font excluded)
+    size_t textureCacheBudget = 16 * 1024 * 1024;
+    int textureCacheMinIdle = 4;
     Shader spriteShader;
+    Shader gsSpriteShader;
+
+    // Released textures keep their immutable storage and are handed out again
+    // for the same width/height/channels; deleted once the budget is exceeded
+    static constexpr size_t TEXTURE_POOL_BUDGET = 32 * 1024 * 1024;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> texturePool;
+    size_t texturePoolBytes = 0;
+
+    // Small TEX* assets, packed at load time (entries live in textureCache)
+    TextureAtlas textureAtlas;
+    std::vector<uint32_t> atlasPages;
+
+    // Mesh system
+    std::unordered_map<std::string, GpuMesh> meshCache;
+
+    // Uploads behind DrawMesh(const ICOBModel&), until ReleaseModelMesh;
+    // re-created if the model's arrays are reallocated or resized
+    struct ModelMesh {
+        const void* vertexData = nullptr;
+        size_t vertexCount = 0;
+        size_t indexCount = 0;
+        GpuMesh mesh;
+    };
+    std::unordered_map<const ICOBModel*, ModelMesh> modelMeshes;
+
+    // Instancing (mat4 model + color per instance, streamed through vertexStream)
+    static constexpr size_t INSTANCE_FLOATS = 20;
+    Shader instancedShader;
+    GpuMesh unitCube;
+    std::unordered_map<int, GpuMesh> unitSpheres;   // Keyed by segment count (one per LOD level)
+
+    // Sphere LOD: picked from projected radius in the 448-line PS2 frame
+    static constexpr int SPHERE_LOD_LEVELS[] = { 4, 6, 8, 12, 16, 24, 32 };
+    static constexpr int SPHERE_LOD_COUNT = 7;
+    static constexpr float SPHERE_LOD_SCREEN_HEIGHT = 448.0f;
+    static constexpr float SPHERE_LOD_EDGE_PIXELS = 6.0f;
+    std::vector<float> instanceScratch;
+    std::vector<InstanceData> sphereScratch;        // Visible spheres, scale made uniform
 
     // Helper methods
     bool LoadShaders();
     bool LoadFont();
+    void BuildTextureAtlas();
+    uint32_t AcquireTexture(int width, int height, int channels);
+    void ReleaseTexture(Texture& tex);
+    void FreeGsTexture(GsTexture& tex);
+    void FreeMesh(GpuMesh& mesh);
+    bool IsFrameInFlight() const { return completedFrame < frameCounter; }
+    void FlushDeferredDeletes();
+    GpuMesh GetModelMesh(const ICOBModel& model);
+    void UploadTexture(uint32_t id, const uint8_t* data, int width, int height, int channels);
+    void EvictTextures(size_t incomingBytes);
+    void PinCachedTexture(const std::string& name, TexturePin pin);
     uint32_t CompileShader(const char* source, uint32_t type);
     bool LinkProgram(uint32_t program);
     std::string ReadShaderFile(const std::string& path);
+    bool BuildProgram(Shader& shader, const std::string& vertSource, const std::string& fragSource);
+
+    // Quad batching
+    void PushQuad(const Shader& shader, uint32_t texture, bool additive, const float* vertices);
+    void PushTextQuads(const TextLayout& layout, float x, float y, float boxWidth, TextAlign align, const Color& color);
+    void PushTextLine(const float* quads, size_t count, float offsetX, float offsetY, const Color& color);
+    void FlushQuads();
+
+    // Text layout (white glyph quads at the origin, see PushTextQuads).
+    // GetCachedTextLayout requires textLayoutMutex
+    void LayoutText(const char* text, float scale, float wrapWidth, TextLayout& out);
+    const TextLayout& GetCachedTextLayout(const char* text, float scale, float wrapWidth);
+
+    // Stream helpers: return base vertex / index byte offset, or -1 / SIZE_MAX
+    int PushVertices(const void* data, size_t count, size_t stride);
+    size_t PushIndices(const void* data, size_t bytes);
     
     // Matrix helpers
     void SetIdentityMatrix(float* matrix);
@@ -155,6 +675,48 @@ private:
     void SetOrthoMatrix(float* matrix, float left, float right, float bottom, float top, float nearP, float farP);
     void SetLookAtMatrix(float* matrix, const Vec3& eye, const Vec3& target, const Vec3& up);
     void MultiplyMatrices(float* result, const float* a, const float* b);
+    void SetModelMatrix(float* matrix, const Vec3& position, const Vec3& scale, const Vec3& rotation);
+    void UseBasicShader(const float* model, const Color& tint, bool fog);
+    void UpdateFrameUniforms();
+    void Apply3DState();
+
+    // Recording helpers
+    uint32_t BeginPacket(const void* args, size_t bytes);
+    void Record3D(DrawOp op, uint32_t dataOffset, const Vec3& position, float alpha);
+    void RecordInstances(DrawOp op, const InstanceData* instances, size_t count, int segments);
+    void CaptureRecordState();
+    void ApplyStateBlock(const StateBlock& block);
+    bool NeedsInvoke() const;
+
+    GpuMesh CreateStaticMesh(const float* vertices, size_t vertexCount,
+                             const void* indices, size_t indexBytes,
+                             uint32_t indexType, int indexCount);
+
+    // Profiling helpers
+    void EnterPass(const char* pass);
+    void DrawProfilerOverlay();
+    void DrawRectBasic(float x, float y, float w, float h, const Color& color);
+    void DrawStatsOverlay(const RenderStats& stats);
+    void CountDraw(uint32_t mode, size_t vertices, size_t indices, size_t instances = 0);
+
+    // Culling (bounding spheres, world space)
+    void UpdateFrustum();
+    bool IsSphereVisible(const Vec3& center, float radius);
+    bool IsMeshVisible(const float* model, const Vec3& scale, const Vec3& center, float radius);
+
+    // Output helpers
+    void BindTarget(const RenderTarget* target, int width, int height);
+    void ResolveFrame();
+    bool RenderBloom();
+    void CreateBloomTargets();
+    void DeleteBloomTargets();
+    
+    // Instancing helpers
+    void DrawInstanced(GpuMesh& mesh, const InstanceData* instances, size_t count, bool cull);
+    void DrawMeshUnculled(const GpuMesh& mesh, const float* model, const Color& color);
+    GpuMesh& GetUnitCube();
+    GpuMesh& GetUnitSphere(int segments);
+    int SelectSphereLod(const Vec3& center, float radius, int maxSegments) const;
     
     // Geometry helpers
     void CreateSphereGeometry(std::vector<float>& vertices, std::vector<uint32_t>& indices, float radius, int segments);
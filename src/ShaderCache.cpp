@@ -0,0 +1,154 @@
+#include "Platform.h"
+#include <GL/glew.h>
+#include "ShaderCache.h"
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// ============================================================================
+// File Layout
+// ============================================================================
+static constexpr uint32_t CACHE_MAGIC = 0x4250534F;    // "OSPB"
+static constexpr uint32_t CACHE_VERSION = 1;
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint32_t binaryFormat;
+    uint32_t length;
+};
+
+static uint64_t Fnv1a(uint64_t hash, const std::string& data) {
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 0x100000001B3ull;
+    }
+    // Separator, so "ab" + "c" and "a" + "bc" hash differently
+    hash ^= 0xFF;
+    hash *= 0x100000001B3ull;
+    return hash;
+}
+
+static std::string GetGLString(GLenum name) {
+    const char* value = (const char*)glGetString(name);
+    return value ? value : "";
+}
+
+// ============================================================================
+// ShaderCache Implementation
+// ============================================================================
+bool ShaderCache::Init(const std::string& dir) {
+    directory = dir;
+    hits = misses = 0;
+
+    GLint formats = 0;
+    if (GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary) {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    }
+    available = formats > 0;
+    if (!available) {
+        printf("[ShaderCache] Program binaries unsupported, compiling from source\n");
+        return false;
+    }
+
+    driverId = GetGLString(GL_VENDOR) + "|" + GetGLString(GL_RENDERER) + "|" + GetGLString(GL_VERSION);
+
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (ec) {
+        printf("[ShaderCache] Cannot create %s: %s\n", directory.c_str(), ec.message().c_str());
+        available = false;
+        return false;
+    }
+
+    printf("[ShaderCache] Enabled (%s, %d binary format(s))\n", directory.c_str(), formats);
+    return true;
+}
+
+uint64_t ShaderCache::MakeKey(const std::string& vertSource, const std::string& fragSource) const {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    hash = Fnv1a(hash, vertSource);
+    hash = Fnv1a(hash, fragSource);
+    hash = Fnv1a(hash, driverId);
+    return hash;
+}
+
+std::string ShaderCache::PathFor(uint64_t key) const {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+    return directory + name;
+}
+
+void ShaderCache::PrepareProgram(uint32_t program) const {
+    if (available) {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+}
+
+bool ShaderCache::Load(uint64_t key, uint32_t program) {
+    if (!available) {
+        misses++;
+        return false;
+    }
+
+    std::ifstream file(PathFor(key), std::ios::binary);
+    CacheHeader header = {};
+    if (!file.is_open() || !file.read((char*)&header, sizeof(header)) ||
+        header.magic != CACHE_MAGIC || header.version != CACHE_VERSION || header.key != key) {
+        misses++;
+        return false;
+    }
+
+    std::vector<char> binary(header.length);
+    if (!file.read(binary.data(), header.length)) {
+        misses++;
+        return false;
+    }
+
+    glProgramBinary(program, header.binaryFormat, binary.data(), (GLsizei)header.length);
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        // Driver update with unchanged strings, or a corrupt file: recompile
+        printf("[ShaderCache] Binary %016llx rejected by the driver\n", (unsigned long long)key);
+        misses++;
+        return false;
+    }
+
+    hits++;
+    return true;
+}
+
+void ShaderCache::Store(uint64_t key, uint32_t program) {
+    if (!available) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+    if (length <= 0) return;
+
+    // Written to a temporary name first so a crash never leaves a torn file
+    std::string path = PathFor(key);
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return;
+        CacheHeader header = { CACHE_MAGIC, CACHE_VERSION, key, format, (uint32_t)length };
+        file.write((const char*)&header, sizeof(header));
+        file.write(binary.data(), length);
+        if (!file) return;
+    }
+
+    std::error_code ec;
+    fs::rename(tempPath, path, ec);
+    if (ec) {
+        fs::remove(tempPath, ec);
+    }
+}
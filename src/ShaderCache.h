@@ -0,0 +1,39 @@
+#pragma once
+// ============================================================================
+// ShaderCache.h - On-disk cache of linked program binaries
+//
+// Programs are stored with glGetProgramBinary under shadercache/, one file per
+// program, keyed by an FNV-1a hash of the shader sources and the GL vendor,
+// renderer and version strings. A driver or source change yields a new key;
+// a binary the driver rejects anyway is simply recompiled and overwritten.
+// ============================================================================
+
+#include <cstdint>
+#include <string>
+
+class ShaderCache {
+public:
+    // GL thread, after context creation. Returns false when binaries are unsupported
+    bool Init(const std::string& directory = "shadercache/");
+    bool IsAvailable() const { return available; }
+
+    uint64_t MakeKey(const std::string& vertSource, const std::string& fragSource) const;
+
+    // Load into an existing (unlinked) program; true if the driver linked it
+    bool Load(uint64_t key, uint32_t program);
+    // Call before glLinkProgram so the driver keeps the binary retrievable
+    void PrepareProgram(uint32_t program) const;
+    void Store(uint64_t key, uint32_t program);
+
+    int GetHits() const { return hits; }
+    int GetMisses() const { return misses; }
+
+private:
+    bool available = false;
+    std::string directory;
+    std::string driverId;       // vendor + renderer + version
+    int hits = 0;
+    int misses = 0;
+
+    std::string PathFor(uint64_t key) const;
+};
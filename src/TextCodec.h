@@ -0,0 +1,25 @@
+#pragma once
+// ============================================================================
+// TextCodec.h - UTF-8 / Shift-JIS helpers for on-screen text
+//
+// Renderer::DrawText takes UTF-8. Save titles on the memory card are stored in
+// Shift-JIS and are converted with ShiftJisToUtf8 before drawing. The JIS table
+// only covers the rows the FNTEX banks hold glyphs for (see FontLoader.h);
+// other characters decode to U+FFFD.
+// ============================================================================
+
+#include <cstdint>
+#include <string>
+
+namespace TextCodec {
+    constexpr uint32_t REPLACEMENT = 0xFFFD;
+
+    // Decode one codepoint and advance text (REPLACEMENT on malformed input)
+    uint32_t NextUtf8(const char*& text);
+    void AppendUtf8(std::string& out, uint32_t codepoint);
+
+    std::string ShiftJisToUtf8(const char* sjis);
+
+    // JIS X 0208 row/cell (1-based) -> Unicode, 0 when outside the table
+    uint32_t KutenToUnicode(int ku, int ten);
+}
@@ -0,0 +1,95 @@
+#include "Platform.h"
+#include "TextureAtlas.h"
+
+// ============================================================================
+// TextureAtlas Implementation
+// ============================================================================
+bool TextureAtlas::Fits(int width, int height) {
+    return width > 0 && height > 0 && width <= MAX_ENTRY_SIZE && height <= MAX_ENTRY_SIZE;
+}
+
+bool TextureAtlas::Add(const TexData& tex, Entry& out) {
+    if (!Fits(tex.width, tex.height) || tex.pixels.size() < (size_t)tex.width * tex.height * 4) {
+        return false;
+    }
+
+    int page, x, y;
+    if (!Allocate(tex.width + PADDING * 2, tex.height + PADDING * 2, page, x, y)) {
+        return false;
+    }
+
+    Blit(pages[page], tex, x + PADDING, y + PADDING);
+    pages[page].usedPixels += tex.width * tex.height;
+
+    out.page = page;
+    out.x = x + PADDING;
+    out.y = y + PADDING;
+    out.width = tex.width;
+    out.height = tex.height;
+    return true;
+}
+
+void TextureAtlas::ReleaseStaging() {
+    for (Page& page : pages) {
+        std::vector<uint8_t>().swap(page.pixels);
+    }
+}
+
+void TextureAtlas::Clear() {
+    pages.clear();
+    shelves.clear();
+    pageBottoms.clear();
+}
+
+bool TextureAtlas::Allocate(int width, int height, int& page, int& x, int& y) {
+    // Best fit: the lowest existing shelf that is tall and wide enough
+    Shelf* best = nullptr;
+    for (Shelf& shelf : shelves) {
+        if (shelf.height >= height && PAGE_SIZE - shelf.cursorX >= width &&
+            (!best || shelf.height < best->height)) {
+            best = &shelf;
+        }
+    }
+
+    if (!best) {
+        // Open a new shelf on the first page with room, or a new page
+        int target = -1;
+        for (int i = 0; i < (int)pages.size(); i++) {
+            if (PAGE_SIZE - pageBottoms[i] >= height) {
+                target = i;
+                break;
+            }
+        }
+        if (target < 0) {
+            pages.emplace_back();
+            pages.back().pixels.assign((size_t)PAGE_SIZE * PAGE_SIZE * 4, 0);
+            pageBottoms.push_back(0);
+            target = (int)pages.size() - 1;
+        }
+
+        shelves.push_back({ target, pageBottoms[target], height, 0 });
+        pageBottoms[target] += height;
+        best = &shelves.back();
+    }
+
+    page = best->page;
+    x = best->cursorX;
+    y = best->y;
+    best->cursorX += width;
+    return true;
+}
+
+void TextureAtlas::Blit(Page& page, const TexData& tex, int x, int y) {
+    // Rows -PADDING .. height+PADDING-1, clamped to the source edge
+    for (int row = -PADDING; row < tex.height + PADDING; row++) {
+        int srcRow = std::min(std::max(row, 0), tex.height - 1);
+        const uint8_t* src = tex.pixels.data() + (size_t)srcRow * tex.width * 4;
+        uint8_t* dst = page.pixels.data() + ((size_t)(y + row) * PAGE_SIZE + x) * 4;
+
+        memcpy(dst, src, (size_t)tex.width * 4);
+        for (int p = 1; p <= PADDING; p++) {
+            memcpy(dst - p * 4, src, 4);
+            memcpy(dst + (tex.width - 1 + p) * 4, src + (tex.width - 1) * 4, 4);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+// ============================================================================
+// TextureAtlas.h - Shelf packer for the small OSD textures (TEX*.bin)
+//
+// Textures are packed at load time into RGBA8 staging pages; the Renderer
+// uploads each page as one GL texture and hands out Textures that carry the
+// page id plus a UV rect, so sprites from different assets share a binding
+// and batch together. Every entry gets a border of replicated edge texels
+// so linear filtering never samples a neighbour.
+// ============================================================================
+
+#include "TextureLoader.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class TextureAtlas {
+public:
+    static constexpr int PAGE_SIZE = 1024;
+    static constexpr int MAX_ENTRY_SIZE = 256;  // Larger textures keep their own GL texture
+    static constexpr int PADDING = 1;           // Replicated edge texels around each entry
+
+    // Placement of one texture (inner rect, without the padding)
+    struct Entry {
+        int page = -1;
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    struct Page {
+        std::vector<uint8_t> pixels;    // RGBA8 staging, dropped after upload
+        int usedPixels = 0;
+    };
+
+    static bool Fits(int width, int height);
+
+    // Pack and copy into the staging page. Add tallest first for tight shelves
+    bool Add(const TexData& tex, Entry& out);
+
+    int GetPageCount() const { return (int)pages.size(); }
+    const Page& GetPage(int index) const { return pages[index]; }
+    void ReleaseStaging();
+    void Clear();
+
+private:
+    struct Shelf {
+        int page;
+        int y;
+        int height;
+        int cursorX;
+    };
+
+    std::vector<Page> pages;
+    std::vector<Shelf> shelves;
+    std::vector<int> pageBottoms;     // First free row per page
+
+    bool Allocate(int width, int height, int& page, int& x, int& y);
+    void Blit(Page& page, const TexData& tex, int x, int y);
+};
@@ -234,7 +234,7 @@ PS2_PSM TextureLoader::DetectPSM(size_t size, int& w, int& h, int& offset) {
     return GS_PSM_32; // Default falha
 }
 
-bool TextureLoader::LoadFromPath(const std::string& path, TexData& out) {
+bool TextureLoader::LoadRawFromPath(const std::string& path, GsRawData& out) {
     std::ifstream f(path, std::ios::binary | std::ios::ate);
     if(!f.is_open()) return false;
     size_t size = f.tellg();
@@ -242,20 +242,52 @@ bool TextureLoader::LoadFromPath(const std::string& path, TexData& out) {
     std::vector<uint8_t> data(size);
     f.read((char*)data.data(), size);
     
-    int w,h,off;
-    out.originalPsm = DetectPSM(size, w, h, off);
-    
+    int w = 0, h = 0, off = 0;
+    out.psm = DetectPSM(size, w, h, off);
+    if (w <= 0 || h <= 0) return false;    // Formato não reconhecido
     out.width = w;
     out.height = h;
-    out.valid = true;
     
     // Verifica boundaries
-    if (off + (w*h)/(out.originalPsm==GS_PSM_4 ? 2 : (out.originalPsm==GS_PSM_16?0.5:1)) > size) {
+    if (off + (w*h)/(out.psm==GS_PSM_4 ? 2 : (out.psm==GS_PSM_16?0.5:1)) > size) {
         // Se calculado mal, tenta sem offset
         off = 0;
     }
     
-    const uint8_t* ptr = data.data() + off;
+    // Leitura swizzled endereça páginas inteiras do GS (8 KB); dumps menores
+    // que isso (ex.: 64x128 em PSM8) são completados com zeros
+    int pageW = 64, pageH = 32;
+    if (out.psm == GS_PSM_16) { pageW = 64; pageH = 64; }
+    else if (out.psm == GS_PSM_8) { pageW = 128; pageH = 64; }
+    else if (out.psm == GS_PSM_4) { pageW = 128; pageH = 128; }
+    size_t swizzledBytes = (size_t)((w + pageW - 1) / pageW) * ((h + pageH - 1) / pageH) * 8192;
+    if (data.size() < off + swizzledBytes) {
+        data.resize(off + swizzledBytes, 0);
+    }
+    
+    // Payload sem header
+    data.erase(data.begin(), data.begin() + off);
+    out.data = std::move(data);
+    out.clut.clear();   // OSD usa as texturas indexadas como máscara (ver Read8)
+    return true;
+}
+
+bool TextureLoader::LoadRaw(const std::string& name, GsRawData& out) {
+    std::string fullPath = directory + name + ".bin";
+    if (!fs::exists(fullPath)) fullPath = directory + name;
+    return LoadRawFromPath(fullPath, out);
+}
+
+bool TextureLoader::LoadFromPath(const std::string& path, TexData& out) {
+    GsRawData raw;
+    if (!LoadRawFromPath(path, raw)) return false;
+    
+    out.originalPsm = raw.psm;
+    out.width = raw.width;
+    out.height = raw.height;
+    out.valid = true;
+    
+    const uint8_t* ptr = raw.data.data();
 
     // Redireciona para leitor correto
     switch(out.originalPsm) {
@@ -420,22 +452,13 @@ bool TextureLoader::Read8(const uint8_t* src, TexData& out) {
                 out.pixels[dstIdx+0] = 255;
                 out.pixels[dstIdx+1] = 255;
                 out.pixels[dstIdx+2] = 255;
-                // PS2 range 0..128 para 255. Ou 0..255.
-                out.pixels[dstIdx+3] = (val > 128) ? 255 : (val * 2);
+                // PS2 range 0..128 para 255 (128 * 2 estourava o uint8 e virava 0)
+                out.pixels[dstIdx+3] = (val >= 128) ? 255 : (val * 2);
             }
         }
     }
     return true;
 }
-bool hasHeader = false;
-
-if (size >= 24) {
-    uint32_t marker = *(uint32_t*)(data + 8);
-    if (marker == 0x10) hasHeader = true;
-}
-
-offset = hasHeader ? 24 : 0;
-tex.layout = hasHeader ? TexLayout::Swizzled : TexLayout::Linear;
 
 bool TextureLoader::Read4(const uint8_t* src, TexData& out) {
     out.pixels.resize(out.width * out.height * 4);
@@ -5,6 +5,7 @@
 
 enum PS2_PSM {
     GS_PSM_32,
+    GS_PSM_24,
     GS_PSM_16,
     GS_PSM_16S,
     GS_PSM_8,
@@ -19,23 +20,56 @@ enum class TexLayout {
     Swizzled
 };
 
+// Formato original do arquivo (os pixels de saída são sempre RGBA8)
+enum class TexFormat {
+    RGBA32,
+    RGBA16,
+    Indexed8,
+    Indexed4
+};
+
 struct TexData {
     int width = 0;
     int height = 0;
-    PS2_PSM psm = GS_PSM_32;
+    PS2_PSM originalPsm = GS_PSM_32;
+    TexFormat format = TexFormat::RGBA32;
     TexLayout layout = TexLayout::Linear;
-    std::vector<uint8_t> pixels;
+    bool valid = false;
+    std::vector<uint8_t> pixels;    // RGBA8, linear (y * width + x)
+};
+
+// Payload GS como está no arquivo (swizzled), para decodificação na GPU
+// (ver shaders/gs_sprite.frag). Completado até páginas inteiras do GS.
+struct GsRawData {
+    int width = 0;
+    int height = 0;
+    PS2_PSM psm = GS_PSM_32;
+    std::vector<uint8_t> data;
+    std::vector<uint32_t> clut;     // 256 x ABGR; vazio = indexadas são máscara de alpha
 };
 
 class TextureLoader {
 public:
-    bool LoadFromFile(const std::string& path, TexData& out);
+    TextureLoader();
+    ~TextureLoader();
+
+    void SetDirectory(const std::string& dir);
+    std::vector<std::string> GetAvailableTextures() const;
+
+    bool Load(const std::string& name, TexData& out);        // DIRECTORY/NAME.bin
+    bool LoadFromPath(const std::string& path, TexData& out);
+    bool LoadRaw(const std::string& name, GsRawData& out);     // Sem conversão (memcpy)
+    bool LoadRawFromPath(const std::string& path, GsRawData& out);
 
 private:
+    std::string directory;
+
     uint32_t GetGSAddress(uint32_t x, uint32_t y, uint32_t bufferWidth, PS2_PSM psm);
+    PS2_PSM DetectPSM(size_t size, int& w, int& h, int& offset);
+    void UnswizzleClut(const uint8_t* rawPal, uint32_t* outPal32);
 
-    bool Read32(const uint8_t* src, TexData& out, uint32_t bufferWidth);
-    bool Read16(const uint8_t* src, TexData& out, uint32_t bufferWidth);
-    bool Read8(const uint8_t* src, TexData& out, uint32_t bufferWidth);
-    bool Read4(const uint8_t* src, TexData& out, uint32_t bufferWidth);
+    bool Read32(const uint8_t* src, TexData& out);
+    bool Read16(const uint8_t* src, TexData& out);
+    bool Read8(const uint8_t* src, TexData& out);
+    bool Read4(const uint8_t* src, TexData& out);
 };
@@ -0,0 +1,35 @@
+#include "Platform.h"
+#include "BenchAlloc.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// ============================================================================
+// Counters
+// Relaxed atomics: the render thread is not used by the bench, but SDL and
+// the driver may allocate from their own threads
+// ============================================================================
+static std::atomic<uint64_t> allocCount{0};
+static std::atomic<uint64_t> allocBytes{0};
+
+uint64_t BenchAlloc::GetCount() { return allocCount.load(std::memory_order_relaxed); }
+uint64_t BenchAlloc::GetBytes() { return allocBytes.load(std::memory_order_relaxed); }
+
+static void* CountedAlloc(size_t size) {
+    allocCount.fetch_add(1, std::memory_order_relaxed);
+    allocBytes.fetch_add(size, std::memory_order_relaxed);
+    void* ptr = malloc(size ? size : 1);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+// ============================================================================
+// Global operator new/delete replacements
+// Over-aligned types keep the default aligned overloads and are not counted
+// ============================================================================
+void* operator new(size_t size) { return CountedAlloc(size); }
+void* operator new[](size_t size) { return CountedAlloc(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
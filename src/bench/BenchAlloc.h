@@ -0,0 +1,15 @@
+#pragma once
+// ============================================================================
+// BenchAlloc.h - Heap allocation counter for osdsys_bench
+//
+// BenchAlloc.cpp replaces the global operator new/delete of the benchmark
+// executable only (the OSDSYS binary keeps the default ones). Counters are
+// cumulative; the harness samples them around each frame.
+// ============================================================================
+
+#include <cstdint>
+
+namespace BenchAlloc {
+    uint64_t GetCount();    // operator new calls since startup
+    uint64_t GetBytes();    // Bytes requested by those calls
+}
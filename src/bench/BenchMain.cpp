@@ -0,0 +1,339 @@
+#define OSDSYS_USE_OPENGL
+#include "Platform.h"  // MUST BE FIRST
+#include <GL/glew.h>
+#include "Core.h"
+#include "Renderer.h"
+#include "FrameStats.h"
+#include "BenchAlloc.h"
+#include <algorithm>
+
+// ============================================================================
+// osdsys_bench - Scene benchmark harness
+// Runs each scene for a fixed number of simulated ticks on an offscreen
+// target, with a fixed RNG seed and a scripted key sequence, so two runs on
+// the same machine render the same frames. Per frame it records CPU time
+// (update + submission), GPU time (GL_TIME_ELAPSED), draw calls, bytes
+// uploaded to GL buffers/textures and heap allocations, and writes a JSON
+// report to diff between builds.
+// ============================================================================
+static constexpr unsigned BENCH_SEED = 0x0D5;
+static constexpr int INPUT_INTERVAL = 30;      // Ticks between scripted key presses
+
+// Navigation only: confirm/back keys would leave the scene
+static const SDL_Keycode INPUT_SCRIPT[] = {
+    SDLK_DOWN, SDLK_DOWN, SDLK_RIGHT, SDLK_UP, SDLK_LEFT, SDLK_UP
+};
+
+struct BenchCounter {
+    uint64_t total = 0;
+    uint64_t max = 0;
+
+    void Add(uint64_t value) {
+        total += value;
+        if (value > max) max = value;
+    }
+};
+
+struct SceneResult {
+    std::string name;
+    uint64_t frames = 0;
+    FrameStats::Histogram cpu;
+    FrameStats::Histogram gpu;
+    BenchCounter drawCalls;
+    BenchCounter uploadBytes;
+    BenchCounter allocations;
+    BenchCounter allocBytes;
+};
+
+static double ElapsedMs(uint64_t start, uint64_t end) {
+    return (end - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
+
+static void SendKey(MainLoopController& mainLoop, SDL_Keycode key) {
+    SDL_Event event;
+    memset(&event, 0, sizeof(event));
+    event.type = SDL_KEYDOWN;
+    event.key.state = SDL_PRESSED;
+    event.key.keysym.sym = key;
+    mainLoop.HandleInput(event);
+
+    event.type = SDL_KEYUP;
+    event.key.state = SDL_RELEASED;
+    mainLoop.HandleInput(event);
+}
+
+// ============================================================================
+// Scene run
+// ============================================================================
+static void RunScene(State state, Renderer& renderer, uint32_t query, double tickRate, int warmup, int frames,
+                     SceneResult& result) {
+    result.name = GetStateName(state);
+    printf("[Bench] %s: %d warmup + %d frames\n", result.name.c_str(), warmup, frames);
+
+    // Fresh controller per scene: no state carried over from the previous run
+    srand(BENCH_SEED);
+    MainLoopController mainLoop;
+    mainLoop.SetTickRate(tickRate);
+    mainLoop.SetSceneLock(true);
+    mainLoop.RequestStateChange(state);
+
+    for (int frame = 0; frame < warmup + frames; frame++) {
+        if (frame > 0 && frame % INPUT_INTERVAL == 0) {
+            int press = frame / INPUT_INTERVAL - 1;
+            SendKey(mainLoop, INPUT_SCRIPT[press % (sizeof(INPUT_SCRIPT) / sizeof(INPUT_SCRIPT[0]))]);
+        }
+
+        uint64_t allocCount = BenchAlloc::GetCount();
+        uint64_t allocBytes = BenchAlloc::GetBytes();
+        uint64_t start = SDL_GetPerformanceCounter();
+
+        mainLoop.StepFixed();
+        renderer.SetTime((float)(frame * mainLoop.GetTickDelta()));
+        glBeginQuery(GL_TIME_ELAPSED, query);
+        renderer.BeginFrame();
+        renderer.SetProfileScope(mainLoop.GetCurrentSceneName());
+        mainLoop.RenderFrame(renderer);
+        renderer.EndFrame();
+        glEndQuery(GL_TIME_ELAPSED);
+
+        uint64_t end = SDL_GetPerformanceCounter();
+        uint64_t frameAllocs = BenchAlloc::GetCount() - allocCount;
+        uint64_t frameAllocBytes = BenchAlloc::GetBytes() - allocBytes;
+
+        // Waiting here keeps frames independent; the result is then ready
+        glFinish();
+        GLuint64 gpuNs = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &gpuNs);
+
+        if (frame < warmup) continue;   // Scene load, first-use uploads and shader warmup
+        result.frames++;
+        result.cpu.Add(ElapsedMs(start, end));
+        result.gpu.Add(gpuNs / 1.0e6);
+        RenderStats stats = renderer.GetRenderStats();
+        result.drawCalls.Add((uint64_t)stats.drawCalls);
+        result.uploadBytes.Add(stats.bufferUploadBytes + stats.textureUploadBytes);
+        result.allocations.Add(frameAllocs);
+        result.allocBytes.Add(frameAllocBytes);
+    }
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+static void PrintResults(const std::vector<SceneResult>& results) {
+    printf("\n[Bench] %-12s %9s %9s %9s %9s %8s %10s %8s\n",
+           "Scene", "cpu p50", "cpu p99", "gpu p50", "gpu p99", "draws", "upload KB", "allocs");
+    for (const SceneResult& r : results) {
+        double n = r.frames ? (double)r.frames : 1.0;
+        printf("[Bench] %-12s %9.3f %9.3f %9.3f %9.3f %8.1f %10.1f %8.1f\n", r.name.c_str(),
+               r.cpu.GetPercentileMs(50.0), r.cpu.GetPercentileMs(99.0),
+               r.gpu.GetPercentileMs(50.0), r.gpu.GetPercentileMs(99.0),
+               r.drawCalls.total / n, r.uploadBytes.total / n / 1024.0, r.allocations.total / n);
+    }
+}
+
+static void WriteTiming(FILE* file, const char* name, const FrameStats::Histogram& h) {
+    fprintf(file, ",\n      \"%s\": {\"avg\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f}",
+            name, h.GetAverageMs(), h.GetPercentileMs(50.0), h.GetPercentileMs(95.0),
+            h.GetPercentileMs(99.0), h.GetMaxMs());
+}
+
+static void WriteCounter(FILE* file, const char* name, const BenchCounter& c, uint64_t frames) {
+    fprintf(file, ",\n      \"%s\": {\"avg\": %.2f, \"max\": %llu, \"total\": %llu}", name,
+            frames ? (double)c.total / frames : 0.0, (unsigned long long)c.max, (unsigned long long)c.total);
+}
+
+static bool WriteReport(const std::string& path, const std::vector<SceneResult>& results,
+                        int warmup, int frames, int width, int height, double tickRate) {
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        printf("[Bench] Cannot write %s\n", path.c_str());
+        return false;
+    }
+
+    // Driver string is the only free text: drop characters JSON would need escaped
+    std::string glRenderer = (const char*)glGetString(GL_RENDERER);
+    glRenderer.erase(std::remove_if(glRenderer.begin(), glRenderer.end(),
+                                    [](char c) { return c == '"' || c == '\\' || (unsigned char)c < 0x20; }),
+                     glRenderer.end());
+
+    fprintf(file, "{\n  \"gl_renderer\": \"%s\",\n  \"width\": %d,\n  \"height\": %d,\n"
+                  "  \"tick_rate_hz\": %.4f,\n  \"warmup_frames\": %d,\n  \"frames\": %d,\n"
+                  "  \"times_in\": \"ms\",\n  \"scenes\": {",
+            glRenderer.c_str(), width, height, tickRate, warmup, frames);
+    bool first = true;
+    for (const SceneResult& r : results) {
+        fprintf(file, "%s\n    \"%s\": {\n      \"frames\": %llu", first ? "" : ",",
+                r.name.c_str(), (unsigned long long)r.frames);
+        first = false;
+        WriteTiming(file, "cpu", r.cpu);
+        WriteTiming(file, "gpu", r.gpu);
+        WriteCounter(file, "draw_calls", r.drawCalls, r.frames);
+        WriteCounter(file, "upload_bytes", r.uploadBytes, r.frames);
+        WriteCounter(file, "allocations", r.allocations, r.frames);
+        WriteCounter(file, "alloc_bytes", r.allocBytes, r.frames);
+        fprintf(file, "\n    }");
+    }
+    fprintf(file, "\n  }\n}\n");
+
+    bool ok = !ferror(file);
+    fclose(file);
+    printf("[Bench] Wrote %s\n", path.c_str());
+    return ok;
+}
+
+// ============================================================================
+// Entry point
+// ============================================================================
+static bool ParseSceneList(const char* list, std::vector<State>& scenes) {
+    scenes.clear();
+    std::string names = list;
+    size_t pos = 0;
+    while (pos <= names.size()) {
+        size_t comma = names.find(',', pos);
+        if (comma == std::string::npos) comma = names.size();
+        std::string name = names.substr(pos, comma - pos);
+        State state;
+        if (!ParseStateName(name.c_str(), state)) {
+            printf("[ERROR] Unknown scene '%s'\n", name.c_str());
+            return false;
+        }
+        scenes.push_back(state);
+        pos = comma + 1;
+    }
+    return !scenes.empty();
+}
+
+int main(int argc, char** argv) {
+    int frames = 600;
+    int warmup = 60;
+    int width = 640;
+    int height = 448;
+    double tickRate = FixedTimeStep::RATE_60;
+    std::string output = "bench_report.json";
+    std::vector<State> scenes = { State::SCELogo, State::Boot, State::Menu, State::Browser,
+                                  State::DebugVu1Scene, State::DebugFont, State::DebugSound,
+                                  State::DebugTexture };
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            warmup = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--scenes") == 0 && i + 1 < argc) {
+            if (!ParseSceneList(argv[++i], scenes)) return 1;
+        } else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0) {
+                printf("[ERROR] Invalid --size '%s' (expected WIDTHxHEIGHT)\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            const char* rate = argv[++i];
+            tickRate = SDL_strcasecmp(rate, "ntsc") == 0 ? FixedTimeStep::RATE_NTSC
+                     : SDL_strcasecmp(rate, "pal") == 0 ? FixedTimeStep::RATE_PAL : atof(rate);
+            if (tickRate <= 0.0) {
+                printf("[ERROR] Invalid --tick-rate '%s' (expected ntsc, pal or Hz)\n", rate);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            printf("Usage: osdsys_bench [--frames N] [--warmup N] [--scenes Boot,Menu,...]\n"
+                   "                    [--size WxH] [--tick-rate ntsc|pal|Hz] [--output report.json]\n");
+            return 1;
+        }
+    }
+    if (frames <= 0 || warmup < 0) {
+        printf("[ERROR] --frames must be > 0 and --warmup >= 0\n");
+        return 1;
+    }
+
+    // Same offscreen setup as OSDSYS --headless
+    if (!SDL_getenv("SDL_VIDEODRIVER")) {
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "offscreen");
+    }
+    // DebugSound opens the mixer itself; keep it silent and device-independent
+    if (!SDL_getenv("SDL_AUDIODRIVER")) {
+        SDL_SetHint(SDL_HINT_AUDIODRIVER, "dummy");
+    }
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        printf("[ERROR] SDL init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_COMPATIBILITY);
+
+    SDL_Window* window = SDL_CreateWindow("osdsys_bench", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+                                          width, height, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    if (!window) {
+        printf("[ERROR] Window creation failed: %s\n", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+    SDL_GLContext glContext = SDL_GL_CreateContext(window);
+    if (!glContext) {
+        printf("[ERROR] OpenGL context creation failed: %s\n", SDL_GetError());
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return 1;
+    }
+    SDL_GL_SetSwapInterval(0);
+
+    glewExperimental = GL_TRUE;
+    GLenum glewErr = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    if (glewErr == GLEW_ERROR_NO_GLX_DISPLAY) {
+        glewErr = GLEW_OK;
+    }
+#endif
+    if (glewErr != GLEW_OK) {
+        printf("[ERROR] GLEW initialization failed: %s\n", glewGetErrorString(glewErr));
+        SDL_GL_DeleteContext(glContext);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return 1;
+    }
+    printf("[Bench] %s (%s), %dx%d, %.2f Hz ticks\n", glGetString(GL_RENDERER), glGetString(GL_VERSION),
+           width, height, tickRate);
+
+    Renderer renderer;
+    renderer.SetOutputSize(width, height);
+    if (!renderer.Init()) {
+        printf("[ERROR] Renderer initialization failed!\n");
+        SDL_GL_DeleteContext(glContext);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return 1;
+    }
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+    bool ok = false;
+    RenderTarget offscreen = renderer.CreateRenderTarget(width, height);
+    if (!offscreen.valid) {
+        printf("[ERROR] Offscreen render target creation failed!\n");
+    } else {
+        renderer.SetOutputTarget(&offscreen);
+
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        std::vector<SceneResult> results(scenes.size());
+        for (size_t i = 0; i < scenes.size(); i++) {
+            RunScene(scenes[i], renderer, query, tickRate, warmup, frames, results[i]);
+        }
+        glDeleteQueries(1, &query);
+
+        PrintResults(results);
+        ok = WriteReport(output, results, warmup, frames, width, height, tickRate);
+
+        renderer.SetOutputTarget(nullptr);
+        renderer.DeleteRenderTarget(offscreen);
+    }
+
+    renderer.Shutdown();
+    SDL_GL_DeleteContext(glContext);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return ok ? 0 : 1;
+}
@@ -3,8 +3,78 @@
 #include <GL/glew.h>    // GLEW MUST come after Platform.h but before any OpenGL calls
 #include "Core.h"
 #include "Renderer.h"
+#include "RenderThread.h"
+#include "FrameStats.h"
 #include "scenes/DebugVu1Scene.h"
 
+static double ElapsedMs(uint64_t start, uint64_t end) {
+    return (end - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
+
+// Summary to stdout, plus <prefix>.json / <prefix>.csv when a prefix is set
+static void DumpFrameStats(const FrameStats& stats, const std::string& prefix) {
+    stats.PrintSummary();
+    if (!prefix.empty()) {
+        stats.WriteJson(prefix + ".json");
+        stats.WriteCsv(prefix + ".csv");
+    }
+}
+
+// ============================================================================
+// Headless benchmark
+// Runs the loaded scene for a fixed number of frames as fast as possible.
+// Every frame advances exactly one fixed tick and waits for the GPU, so the
+// frame times are reproducible and include GPU work.
+// ============================================================================
+static void RunHeadless(MainLoopController& mainLoop, Renderer& renderer, int frameCount, FrameStats& frameStats) {
+    printf("[Headless] Rendering %d frames...\n", frameCount);
+
+    double totalMs = 0.0;
+    double minMs = 1.0e9;
+    double maxMs = 0.0;
+
+    for (int frame = 0; frame < frameCount; frame++) {
+        uint64_t start = SDL_GetPerformanceCounter();
+
+        {
+            GpuProfiler::CpuScope timer(renderer.GetProfiler(), mainLoop.GetCurrentSceneName(), "Update");
+            mainLoop.StepFixed();
+        }
+        uint64_t renderStart = SDL_GetPerformanceCounter();
+
+        renderer.SetTime((float)(frame * mainLoop.GetTickDelta()));
+        renderer.BeginFrame();
+        renderer.SetProfileScope(mainLoop.GetCurrentSceneName());
+        {
+            GpuProfiler::CpuScope timer(renderer.GetProfiler(), mainLoop.GetCurrentSceneName(), "Render");
+            mainLoop.RenderFrame(renderer);
+        }
+        renderer.EndFrame();
+        uint64_t finishStart = SDL_GetPerformanceCounter();
+        glFinish();     // Stands in for the swap: waits for the GPU
+        uint64_t end = SDL_GetPerformanceCounter();
+
+        double ms = ElapsedMs(start, end);
+        frameStats.AddFrame(mainLoop.GetCurrentSceneName(), ElapsedMs(start, renderStart),
+                            ElapsedMs(renderStart, finishStart), ElapsedMs(finishStart, end), ms);
+        totalMs += ms;
+        if (ms < minMs) minMs = ms;
+        if (ms > maxMs) maxMs = ms;
+    }
+
+    if (frameCount > 0) {
+        double avgMs = totalMs / frameCount;
+        printf("[Headless] Scene %s: %d frames in %.1f ms\n", mainLoop.GetCurrentSceneName(), frameCount, totalMs);
+        printf("[Headless] Frame time avg %.3f ms, min %.3f ms, max %.3f ms (%.1f FPS)\n",
+               avgMs, minMs, maxMs, avgMs > 0.0 ? 1000.0 / avgMs : 0.0);
+    }
+
+    TextureCacheStats cache = renderer.GetTextureCacheStats();
+    printf("[Headless] Texture cache: %llu hits, %llu misses, %llu evictions, %zu/%zu KB resident\n",
+           (unsigned long long)cache.hits, (unsigned long long)cache.misses,
+           (unsigned long long)cache.evictions, cache.residentBytes / 1024, cache.budgetBytes / 1024);
+}
+
 // ============================================================================
 // Main entry point
 // Implements initialization and main loop similar to sub_209EB8
@@ -15,6 +85,92 @@ int main(int argc, char** argv) {
     printf("  Based on reverse engineering of PS2 OSDSYS\n");
     printf("=======================================================\n\n");
 
+    // Command line options
+    bool useRenderThread = false;
+    bool headless = false;
+    int headlessFrames = 600;
+    int headlessWidth = 640;
+    int headlessHeight = 448;
+    int internalWidth = 640;
+    int internalHeight = 448;
+    UpscaleFilter upscaleFilter = UpscaleFilter::SharpBilinear;
+    bool bloom = true;
+    bool hasStartScene = false;
+    State startScene = State::SCELogo;
+    double tickRate = FixedTimeStep::RATE_60;
+    int swapInterval = 1;   // 0 off, 1 vsync, -1 adaptive (late frames tear instead of waiting)
+    std::string frameStatsPrefix;   // Dump files on exit (F8 dumps at any time)
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--render-thread") == 0) {
+            useRenderThread = true;
+        } else if (strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            headlessFrames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &headlessWidth, &headlessHeight) != 2 ||
+                headlessWidth <= 0 || headlessHeight <= 0) {
+                printf("[ERROR] Invalid --size '%s' (expected WIDTHxHEIGHT)\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--internal-res") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &internalWidth, &internalHeight) != 2 ||
+                internalWidth <= 0 || internalHeight <= 0) {
+                printf("[ERROR] Invalid --internal-res '%s' (expected WIDTHxHEIGHT)\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--nearest") == 0) {
+            upscaleFilter = UpscaleFilter::Nearest;
+        } else if (strcmp(argv[i], "--no-bloom") == 0) {
+            bloom = false;
+        } else if (strcmp(argv[i], "--scene") == 0 && i + 1 < argc) {
+            if (!ParseStateName(argv[++i], startScene)) {
+                printf("[ERROR] Unknown scene '%s'\n", argv[i]);
+                return 1;
+            }
+            hasStartScene = true;
+        } else if (strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            const char* rate = argv[++i];
+            if (SDL_strcasecmp(rate, "ntsc") == 0) {
+                tickRate = FixedTimeStep::RATE_NTSC;
+            } else if (SDL_strcasecmp(rate, "pal") == 0) {
+                tickRate = FixedTimeStep::RATE_PAL;
+            } else {
+                tickRate = atof(rate);
+                if (tickRate <= 0.0) {
+                    printf("[ERROR] Invalid --tick-rate '%s' (expected ntsc, pal or Hz)\n", rate);
+                    return 1;
+                }
+            }
+        } else if (strcmp(argv[i], "--frame-stats") == 0 && i + 1 < argc) {
+            frameStatsPrefix = argv[++i];
+        } else if (strcmp(argv[i], "--vsync") == 0 && i + 1 < argc) {
+            const char* mode = argv[++i];
+            if (strcmp(mode, "off") == 0) {
+                swapInterval = 0;
+            } else if (strcmp(mode, "on") == 0) {
+                swapInterval = 1;
+            } else if (strcmp(mode, "adaptive") == 0) {
+                swapInterval = -1;
+            } else {
+                printf("[ERROR] Invalid --vsync '%s' (expected on, off or adaptive)\n", mode);
+                return 1;
+            }
+        }
+    }
+
+    if (headless) {
+        // No display on CI boxes: use SDL's offscreen driver (EGL pbuffer /
+        // surfaceless, e.g. Mesa llvmpipe) unless the caller picked a driver
+        if (!SDL_getenv("SDL_VIDEODRIVER")) {
+            SDL_SetHint(SDL_HINT_VIDEODRIVER, "offscreen");
+        }
+        if (useRenderThread) {
+            printf("[Main] --render-thread is ignored in headless mode\n");
+            useRenderThread = false;
+        }
+    }
+
     // SDL initialization
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER) < 0) {
         printf("[ERROR] SDL init failed: %s\n", SDL_GetError());
@@ -27,13 +183,14 @@ int main(int argc, char** argv) {
     // SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_COMPATIBILITY);
 
-    // Create window 
+    // Create window (hidden in headless mode: it only owns the GL context)
     SDL_Window* window = SDL_CreateWindow(
         "OSDSYS Remake",
         SDL_WINDOWPOS_CENTERED,
         SDL_WINDOWPOS_CENTERED,
-        1280, 896, // (640x448 = PS2 native resolution)
-        SDL_WINDOW_OPENGL | SDL_WINDOW_SHOWN
+        headless ? headlessWidth : 1280,
+        headless ? headlessHeight : 896, // (640x448 = PS2 native resolution)
+        SDL_WINDOW_OPENGL | (headless ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE)
     );
 
     if (!window) {
@@ -50,11 +207,25 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    SDL_GL_SetSwapInterval(1); // VSync enabled (~60 Hz)
+    // VSync (off when headless). Adaptive needs EXT_swap_control_tear; fall back to plain vsync
+    if (headless) {
+        swapInterval = 0;
+    }
+    if (SDL_GL_SetSwapInterval(swapInterval) != 0 && swapInterval == -1) {
+        printf("[Main] Adaptive vsync unsupported, using vsync\n");
+        swapInterval = 1;
+        SDL_GL_SetSwapInterval(swapInterval);
+    }
 
     // Initialize GLEW (must be done after OpenGL context creation)
     glewExperimental = GL_TRUE;
     GLenum glewErr = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    // GLX builds of GLEW report this on EGL contexts; entry points still load
+    if (headless && glewErr == GLEW_ERROR_NO_GLX_DISPLAY) {
+        glewErr = GLEW_OK;
+    }
+#endif
     if (glewErr != GLEW_OK) {
         printf("[ERROR] GLEW initialization failed: %s\n", glewGetErrorString(glewErr));
         SDL_GL_DeleteContext(glContext);
@@ -67,13 +238,25 @@ int main(int argc, char** argv) {
     printf("  GLEW Version: %s\n", glewGetString(GLEW_VERSION));
     printf("  OpenGL Version: %s\n", glGetString(GL_VERSION));
     printf("  Renderer: %s\n", glGetString(GL_RENDERER));
-    printf("  Resolution: 640x448 (PS2 native)\n");
-    printf("  VSync: Enabled (60 Hz target)\n\n");
+    if (headless) {
+        printf("  Mode: Headless (%s), %dx%d offscreen\n", SDL_GetCurrentVideoDriver(), headlessWidth, headlessHeight);
+        printf("  VSync: Disabled\n\n");
+    } else {
+        printf("  Resolution: %dx%d internal (PS2 native 640x448), upscaled to window\n", internalWidth, internalHeight);
+        printf("  VSync: %s\n", swapInterval == 0 ? "Disabled" : swapInterval < 0 ? "Adaptive" : "Enabled");
+        printf("  Tick rate: %.2f Hz (render interpolated)\n\n", tickRate);
+    }
 
     // Initialize systems
     MainLoopController mainLoop;
+    mainLoop.SetTickRate(tickRate);
     Renderer renderer;
     
+    int drawableWidth = 0;
+    int drawableHeight = 0;
+    SDL_GL_GetDrawableSize(window, &drawableWidth, &drawableHeight);
+    renderer.SetOutputSize(drawableWidth, drawableHeight);
+    
     if (!renderer.Init()) {
         printf("[ERROR] Renderer initialization failed!\n");
         SDL_GL_DeleteContext(glContext);
@@ -81,9 +264,47 @@ int main(int argc, char** argv) {
         SDL_Quit();
         return 1;
     }
+    renderer.SetInternalResolution(internalWidth, internalHeight);
+    renderer.SetUpscaleFilter(upscaleFilter);
+    renderer.SetBloom(bloom);
 
     // Start with SCELogo scene (pre-boot)
     // Note: MainLoopController already starts at SCELogo
+    if (hasStartScene) {
+        mainLoop.RequestStateChange(startScene);
+    }
+
+    // glClearColor(0.05f, 0.05f, 0.1f, 1.0f); // Dark blue (PS2 background)
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+    // Missed deadlines are judged against the display when it paces us, else the tick
+    FrameStats frameStats;
+    SDL_DisplayMode displayMode;
+    if (swapInterval != 0 && SDL_GetWindowDisplayMode(window, &displayMode) == 0 && displayMode.refresh_rate > 0) {
+        frameStats.SetDeadline(1.0 / displayMode.refresh_rate);
+    } else {
+        frameStats.SetDeadline(mainLoop.GetTickDelta());
+    }
+
+    if (headless) {
+        RenderTarget offscreen = renderer.CreateRenderTarget(headlessWidth, headlessHeight);
+        bool ok = offscreen.valid;
+        if (!ok) {
+            printf("[ERROR] Offscreen render target creation failed!\n");
+        } else {
+            renderer.SetOutputTarget(&offscreen);
+            RunHeadless(mainLoop, renderer, headlessFrames, frameStats);
+            DumpFrameStats(frameStats, frameStatsPrefix);
+            renderer.SetOutputTarget(nullptr);
+            renderer.DeleteRenderTarget(offscreen);
+        }
+
+        renderer.Shutdown();
+        SDL_GL_DeleteContext(glContext);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return ok ? 0 : 1;
+    }
 
     printf("\n[Controls]\n");
     printf("  F1  - Boot Scene (State 0)\n");
@@ -92,15 +313,28 @@ int main(int argc, char** argv) {
     printf("  F4  - SCE Logo (Pre-boot)\n");
     printf("  F5  - Debug Font\n");
     printf("  F6  - Debug Sound\n");
+    printf("  F8  - Dump frame statistics\n");
+    printf("  F9  - Profiler overlay\n");
+    printf("  F10 - Upscale filter (nearest / sharp-bilinear)\n");
+    printf("  F11 - Bloom\n");
+    printf("  F12 - Renderer stats overlay\n");
     printf("  ESC - Quit\n\n");
     printf("=======================================================\n");
     printf("[Main Loop] Starting infinite loop (sub_209EB8)...\n\n");
 
+    // Optional GL thread: scenes record command lists, the thread replays them
+    RenderThread renderThread;
+    if (useRenderThread && !renderThread.Start(window, glContext, renderer)) {
+        printf("[Main] Render thread unavailable, rendering on the main thread\n");
+    }
+
     // Main loop (infinite - matches sub_209EB8 structure)
     bool running = true;
     SDL_Event event;
 
     while (running) {
+        uint64_t frameStart = SDL_GetPerformanceCounter();
+
         // 1. Input processing
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT) {
@@ -109,25 +343,85 @@ int main(int argc, char** argv) {
             if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE) {
                 running = false;
             }
+            if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F8) {
+                DumpFrameStats(frameStats, frameStatsPrefix.empty() ? "framestats" : frameStatsPrefix);
+            }
+            if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F9) {
+                renderer.SetProfilerOverlay(!renderer.IsProfilerOverlayVisible());
+            }
+            if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F10) {
+                bool sharp = renderer.GetUpscaleFilter() == UpscaleFilter::SharpBilinear;
+                renderer.SetUpscaleFilter(sharp ? UpscaleFilter::Nearest : UpscaleFilter::SharpBilinear);
+                printf("[Main] Upscale filter: %s\n", sharp ? "nearest" : "sharp-bilinear");
+            }
+            if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F11) {
+                renderer.SetBloom(!renderer.IsBloomEnabled());
+                printf("[Main] Bloom: %s\n", renderer.IsBloomEnabled() ? "on" : "off");
+            }
+            if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F12) {
+                renderer.SetStatsOverlay(!renderer.IsStatsOverlayVisible());
+            }
+            if (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                SDL_GL_GetDrawableSize(window, &drawableWidth, &drawableHeight);
+                renderer.SetOutputSize(drawableWidth, drawableHeight);
+            }
             
             mainLoop.HandleInput(event);
         }
 
-        // 2. Update logic (fixed timestep - 60 Hz)
-        mainLoop.UpdateLoop();
+        // 2. Update logic (fixed timestep - 60 / 59.94 / 50 Hz)
+        uint64_t updateStart = SDL_GetPerformanceCounter();
+        {
+            GpuProfiler::CpuScope timer(renderer.GetProfiler(), mainLoop.GetCurrentSceneName(), "Update");
+            mainLoop.UpdateLoop();
+        }
+
+        uint64_t renderStart = SDL_GetPerformanceCounter();
 
         // 3. Render frame
-        // glClearColor(0.05f, 0.05f, 0.1f, 1.0f); // Dark blue (PS2 background)
-        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        
-        mainLoop.RenderFrame(renderer);
-        
+        if (renderThread.IsRunning()) {
+            // Record while the render thread replays the previous frame. Waiting
+            // for a free list is this path's swap time (the GL thread swaps)
+            CommandList& list = renderThread.AcquireList();
+            uint64_t recordStart = SDL_GetPerformanceCounter();
+            renderer.BeginRecording(list);
+            renderer.SetTime(SDL_GetTicks() / 1000.0f);
+            renderer.SetProfileScope(mainLoop.GetCurrentSceneName());
+            {
+                GpuProfiler::CpuScope timer(renderer.GetProfiler(), mainLoop.GetCurrentSceneName(), "Record");
+                mainLoop.RenderFrame(renderer);
+            }
+            renderer.EndRecording();
+            renderThread.SubmitList();
+
+            uint64_t end = SDL_GetPerformanceCounter();
+            frameStats.AddFrame(mainLoop.GetCurrentSceneName(), ElapsedMs(updateStart, renderStart),
+                                ElapsedMs(recordStart, end), ElapsedMs(renderStart, recordStart),
+                                ElapsedMs(frameStart, end));
+            continue;
+        }
+
+        renderer.SetTime(SDL_GetTicks() / 1000.0f);
+        renderer.BeginFrame();
+        renderer.SetProfileScope(mainLoop.GetCurrentSceneName());
+        {
+            GpuProfiler::CpuScope timer(renderer.GetProfiler(), mainLoop.GetCurrentSceneName(), "Render");
+            mainLoop.RenderFrame(renderer);
+        }
+        renderer.EndFrame();
+        uint64_t swapStart = SDL_GetPerformanceCounter();
         SDL_GL_SwapWindow(window);
+
+        uint64_t end = SDL_GetPerformanceCounter();
+        frameStats.AddFrame(mainLoop.GetCurrentSceneName(), ElapsedMs(updateStart, renderStart),
+                            ElapsedMs(renderStart, swapStart), ElapsedMs(swapStart, end),
+                            ElapsedMs(frameStart, end));
     }
 
     // Cleanup
     printf("\n[Main Loop] Exiting...\n");
+    DumpFrameStats(frameStats, frameStatsPrefix);
+    renderThread.Stop();
     renderer.Shutdown();
     SDL_GL_DeleteContext(glContext);
     SDL_DestroyWindow(window);
@@ -19,6 +19,7 @@
 // Trail particle (simulating the light streaks during boot)
 struct BootTrail {
     Vec3 position;
+    Vec3 prevPosition;      // At the previous tick (render interpolation)
     Vec3 velocity;
     float alpha;
     float lifetime;
@@ -30,6 +31,7 @@ struct BootTrail {
 struct BootCube {
     Vec3 position;
     Vec3 rotation;
+    Vec3 prevRotation;
     Vec3 rotationSpeed;
     float scale;
     float alpha;
@@ -38,9 +40,10 @@ struct BootCube {
 // Static scene data
 static std::vector<BootTrail> trails;
 static std::vector<BootCube> cubes;
-static ICOBModel ps2LogoMesh;
-static bool ps2LogoLoaded = false;
+static std::vector<InstanceData> cubeInstances;
+static std::vector<InstanceData> headInstances;
 static Vec3 logoRotation = Vec3(0, 0, 0);
+static Vec3 prevLogoRotation = Vec3(0, 0, 0);
 static float logoAlpha = 0.0f;
 static float sceneAlpha = 0.0f;
 
@@ -58,6 +61,7 @@ void BootScene::OnEnter() {
     sceneAlpha = 0.0f;
     logoAlpha = 0.0f;
     logoRotation = Vec3(0, 0, 0);
+    prevLogoRotation = logoRotation;
     
     // Create animated trails (light streaks converging to center)
     trails.clear();
@@ -79,6 +83,7 @@ void BootScene::OnEnter() {
         Vec3 toCenter = Vec3(0, 0, 0) - trail.position;
         float dist = toCenter.Length();
         trail.velocity = toCenter.Normalize() * (150.0f + (i % 10) * 10.0f);
+        trail.prevPosition = trail.position;
         
         trail.alpha = 0.0f;
         trail.lifetime = dist / trail.velocity.Length();
@@ -114,6 +119,7 @@ void BootScene::OnEnter() {
             (i * 0.5f),
             (i * 0.2f)
         );
+        cube.prevRotation = cube.rotation;
         
         cube.rotationSpeed = Vec3(
             0.3f + (i % 3) * 0.15f,
@@ -127,20 +133,6 @@ void BootScene::OnEnter() {
         cubes.push_back(cube);
     }
 
-    // Load PS2 logo mesh (ICOBPS2M)
-    AssetLoader assetLoader;
-    ICOBModel model;
-    
-    if (assetLoader.LoadICOB("ICOBPS2M", model)) {
-        ps2LogoMesh = model;
-        ps2LogoLoaded = true;
-        printf("[BootScene] PS2 Logo loaded: %zu vertices, %zu indices\n", 
-               ps2LogoMesh.vertices.size(), ps2LogoMesh.indices.size());
-    } else {
-        ps2LogoLoaded = false;
-        printf("[BootScene] PS2 Logo not available (using fallback cubes)\n");
-    }
-
     printf("[BootScene] Initialized: %zu trails, %zu cubes\n", trails.size(), cubes.size());
 }
 
@@ -173,6 +165,7 @@ void BootScene::Update(double dt) {
     // Update trails
     for (auto& trail : trails) {
         // Move towards center
+        trail.prevPosition = trail.position;
         trail.position = trail.position + trail.velocity * (float)dt;
         
         // Update alpha based on phase
@@ -199,11 +192,13 @@ void BootScene::Update(double dt) {
             );
             toCenter = Vec3(0, 0, 0) - trail.position;
             trail.velocity = toCenter.Normalize() * (150.0f + ((float)rand() / RAND_MAX) * 50.0f);
+            trail.prevPosition = trail.position;    // Don't interpolate across the respawn
         }
     }
 
     // Update background cubes
     for (auto& cube : cubes) {
+        cube.prevRotation = cube.rotation;
         cube.rotation = cube.rotation + cube.rotationSpeed * (float)dt;
         
         // Fade cubes
@@ -230,6 +225,7 @@ void BootScene::Update(double dt) {
         }
         
         // Slow continuous rotation (PS2 style)
+        prevLogoRotation = logoRotation;
         logoRotation.y += 0.4f * (float)dt;
         logoRotation.x = sinf(t * 0.3f) * 0.1f; // Slight wobble
     }
@@ -248,56 +244,71 @@ void BootScene::Render(Renderer& renderer) {
     // Set fog for depth effect
     renderer.SetFog(0.015f, Vec3(0.02f, 0.02f, 0.08f));
 
-    // Draw background cubes
+    // Draw background cubes (single instanced draw)
+    cubeInstances.clear();
     for (const auto& cube : cubes) {
         if (cube.alpha > 0.01f) {
-            Color cubeColor(0.1f, 0.15f, 0.3f, cube.alpha * sceneAlpha);
-            renderer.DrawCube(cube.position, Vec3(cube.scale), cubeColor, cube.rotation);
+            InstanceData inst;
+            inst.position = cube.position;
+            inst.scale = Vec3(cube.scale);
+            inst.rotation = Math::Lerp(cube.prevRotation, cube.rotation, renderAlpha);
+            inst.color = Color(0.1f, 0.15f, 0.3f, cube.alpha * sceneAlpha);
+            cubeInstances.push_back(inst);
         }
     }
+    renderer.DrawCubesInstanced(cubeInstances.data(), cubeInstances.size());
 
     // Draw trails as lines
+    headInstances.clear();
     for (const auto& trail : trails) {
         if (trail.alpha > 0.01f) {
             Color trailColor = trail.color;
             trailColor.a = trail.alpha * sceneAlpha;
             
             // Draw trail as a line from current position towards center
-            Vec3 trailEnd = trail.position + trail.velocity.Normalize() * (-30.0f);
-            renderer.DrawLine(trail.position, trailEnd, trailColor, trail.width);
+            Vec3 trailPos = Math::Lerp(trail.prevPosition, trail.position, renderAlpha);
+            Vec3 trailEnd = trailPos + trail.velocity.Normalize() * (-30.0f);
+            renderer.DrawLine(trailPos, trailEnd, trailColor, trail.width);
             
-            // Draw a small bright point at the head
-            Color headColor(1.0f, 1.0f, 1.0f, trail.alpha * sceneAlpha * 0.8f);
-            renderer.DrawSphere(trail.position, 2.0f, headColor, 6);
+            // Small bright point at the head (drawn instanced below)
+            InstanceData head;
+            head.position = trailPos;
+            head.scale = Vec3(2.0f);
+            head.color = Color(1.0f, 1.0f, 1.0f, trail.alpha * sceneAlpha * 0.8f);
+            headInstances.push_back(head);
         }
     }
+    renderer.DrawSpheresInstanced(headInstances.data(), headInstances.size(), 6);
 
-    // Draw PS2 logo
-    if (ps2LogoLoaded && logoAlpha > 0.01f) {
+    // Draw PS2 logo (ICOBPS2M, uploaded once and cached by the renderer)
+    GpuMesh ps2LogoMesh = renderer.GetCachedMesh("ICOBPS2M");
+    if (ps2LogoMesh.valid && logoAlpha > 0.01f) {
         // Silver/white logo color with glow effect
         Color logoColor(0.85f, 0.88f, 0.95f, logoAlpha * sceneAlpha);
         Vec3 logoPos(0.0f, 0.0f, 0.0f);
         Vec3 logoScale(12.0f, 12.0f, 12.0f);
         
-        renderer.DrawMesh(ps2LogoMesh, logoPos, logoScale, logoColor, logoRotation);
+        Vec3 logoRot = Math::Lerp(prevLogoRotation, logoRotation, renderAlpha);
+        renderer.DrawMesh(ps2LogoMesh, logoPos, logoScale, logoColor, logoRot);
         
-        // Optional: Draw subtle glow behind logo
-        if (logoAlpha > 0.5f) {
+        // Optional: Draw subtle glow behind logo (bloom does it when enabled)
+        if (logoAlpha > 0.5f && !renderer.IsBloomActive()) {
             Color glowColor(0.3f, 0.4f, 0.8f, (logoAlpha - 0.5f) * 0.3f * sceneAlpha);
             renderer.SetBlendMode(true); // Additive
             renderer.DrawSphere(logoPos, 50.0f, glowColor, 12);
             renderer.SetBlendMode(false); // Back to normal
         }
-    } else if (!ps2LogoLoaded) {
+    } else if (!ps2LogoMesh.valid) {
         // Fallback: show a placeholder cube
         if (logoAlpha > 0.01f) {
             Color fallbackColor(0.4f, 0.5f, 0.8f, logoAlpha * sceneAlpha);
-            renderer.DrawCube(Vec3(0, 0, 0), Vec3(30.0f), fallbackColor, logoRotation);
+            renderer.DrawCube(Vec3(0, 0, 0), Vec3(30.0f), fallbackColor,
+                              Math::Lerp(prevLogoRotation, logoRotation, renderAlpha));
         }
     }
 
     // Draw center convergence point (bright flash when trails arrive)
-    float t = (float)time;
+    float t = RenderTime();
     if (t > 1.5f && t < 2.5f) {
         float flashT = (t - 1.5f) / 1.0f;
         float flashAlpha = sinf(flashT * Math::PI) * 0.5f;
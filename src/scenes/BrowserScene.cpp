@@ -4,6 +4,7 @@
 #include "../Renderer.h"
 #include "../MathTypes.h"
 #include "../Assets.h"
+#include "../TextCodec.h"
 
 // ============================================================================
 // BrowserScene - Memory card browser (State 3)
@@ -24,11 +25,12 @@ struct SaveIcon {
     Vec3 rotation;
     float scale;
     float targetScale;
+    // State at the previous tick (render interpolation)
+    Vec3 prevPosition;
+    Vec3 prevRotation;
+    float prevScale;
     bool selected;
     int assetId;
-    
-    ICOBModel mesh;
-    bool meshLoaded;
 };
 
 struct MemoryCardInfo {
@@ -45,6 +47,8 @@ static float scrollOffset = 0.0f;
 static float targetScrollOffset = 0.0f;
 static float sceneAlpha = 0.0f;
 static MemoryCardInfo mc1, mc2;
+static TextMesh headerText;
+static TextMesh hintText;
 
 // Available ICOB icons to use for save files
 static const char* AVAILABLE_ICONS[] = {
@@ -86,9 +90,11 @@ void BrowserScene::OnEnter() {
     // Create save icons with actual ICOB models
     saveIcons.clear();
     
+    // Titles as stored in icon.sys: Shift-JIS (plain ASCII passes through)
     const char* saveNames[] = {
         "Gran Turismo 4",
-        "Final Fantasy X",
+        "\x83\x74\x83\x40\x83\x43\x83\x69\x83\x8B\x83\x74\x83\x40\x83\x93"
+        "\x83\x5E\x83\x57\x81\x5B\x82\x77",  // ファイナルファンタジーＸ
         "God of War",
         "Shadow of the Colossus",
         "Kingdom Hearts",
@@ -108,11 +114,9 @@ void BrowserScene::OnEnter() {
         "ICOBPS2D"
     };
     
-    AssetLoader assetLoader;
-    
     for (int i = 0; i < 8; i++) {
         SaveIcon icon;
-        icon.name = saveNames[i];
+        icon.name = TextCodec::ShiftJisToUtf8(saveNames[i]);
         icon.iconName = saveIconNames[i];
         
         // Initial positions (stacked list)
@@ -123,20 +127,12 @@ void BrowserScene::OnEnter() {
         icon.rotation = Vec3(0, 0, 0);
         icon.scale = 1.0f;
         icon.targetScale = 1.0f;
+        icon.prevPosition = icon.position;
+        icon.prevRotation = icon.rotation;
+        icon.prevScale = icon.scale;
         icon.selected = (i == 0);
         icon.assetId = i;
         
-        // Try to load ICOB mesh
-        ICOBModel model;
-        if (assetLoader.LoadICOB(icon.iconName, model)) {
-            icon.mesh = model;
-            icon.meshLoaded = true;
-            printf("[BrowserScene] Loaded icon '%s' for '%s'\n", icon.iconName.c_str(), icon.name.c_str());
-        } else {
-            icon.meshLoaded = false;
-            printf("[BrowserScene] Failed to load icon '%s' for '%s'\n", icon.iconName.c_str(), icon.name.c_str());
-        }
-        
         saveIcons.push_back(icon);
     }
 
@@ -215,6 +211,9 @@ void BrowserScene::Update(double dt) {
     // Update save icons
     for (size_t i = 0; i < saveIcons.size(); i++) {
         auto& icon = saveIcons[i];
+        icon.prevPosition = icon.position;
+        icon.prevRotation = icon.rotation;
+        icon.prevScale = icon.scale;
         
         // Target position with scroll
         icon.targetPosition.y = VISIBLE_AREA_TOP - i * ITEM_SPACING + scrollOffset;
@@ -259,7 +258,8 @@ void BrowserScene::Render(Renderer& renderer) {
 
     // Draw header
     Color headerColor(0.9f, 0.9f, 1.0f, sceneAlpha);
-    renderer.DrawText("Memory Card Browser", 200.0f, 30.0f, headerColor, 1.2f);
+    renderer.SetTextMesh(headerText, "Memory Card Browser", 200.0f, 30.0f, headerColor, 1.2f);
+    renderer.DrawTextMesh(headerText);
     
     // Draw memory card info
     Color mcColor = mc1.connected 
@@ -272,41 +272,46 @@ void BrowserScene::Render(Renderer& renderer) {
     // Draw save icons
     for (size_t i = 0; i < saveIcons.size(); i++) {
         const auto& icon = saveIcons[i];
+        Vec3 position = Math::Lerp(icon.prevPosition, icon.position, renderAlpha);
+        Vec3 rotation = Math::Lerp(icon.prevRotation, icon.rotation, renderAlpha);
+        float scale = Math::Lerp(icon.prevScale, icon.scale, renderAlpha);
         
-        // Skip if off-screen
-        if (icon.position.y < -220.0f || icon.position.y > 200.0f) {
+        // Outside the list window: skips the label too. The 3D icon alone
+        // would also be rejected by the renderer's frustum culling
+        if (position.y < -220.0f || position.y > 200.0f) {
             continue;
         }
 
         // Calculate render position
         // Map 3D position to 2D screen approximately
         Vec3 iconPos3D(
-            icon.position.x,
-            icon.position.y,
-            icon.position.z - 100.0f // Push back in Z
+            position.x,
+            position.y,
+            position.z - 100.0f // Push back in Z
         );
         
-        // Draw the 3D icon
-        if (icon.meshLoaded) {
+        // Draw the 3D icon (mesh is uploaded on first use and shared by name)
+        GpuMesh iconMesh = renderer.GetCachedMesh(icon.iconName);
+        if (iconMesh.valid) {
             Color iconColor = icon.selected 
                 ? Color(1.0f, 1.0f, 1.0f, sceneAlpha)
                 : Color(0.7f, 0.7f, 0.8f, 0.8f * sceneAlpha);
             
-            Vec3 iconScale(8.0f * icon.scale, 8.0f * icon.scale, 8.0f * icon.scale);
-            renderer.DrawMesh(icon.mesh, iconPos3D, iconScale, iconColor, icon.rotation);
+            Vec3 iconScale(8.0f * scale, 8.0f * scale, 8.0f * scale);
+            renderer.DrawMesh(iconMesh, iconPos3D, iconScale, iconColor, rotation);
         } else {
             // Fallback: draw a colored cube
             Color fallbackColor = icon.selected 
                 ? Color(0.4f, 0.6f, 0.9f, sceneAlpha)
                 : Color(0.3f, 0.4f, 0.6f, 0.8f * sceneAlpha);
             
-            Vec3 cubeScale(15.0f * icon.scale, 15.0f * icon.scale, 15.0f * icon.scale);
-            renderer.DrawCube(iconPos3D, cubeScale, fallbackColor, icon.rotation);
+            Vec3 cubeScale(15.0f * scale, 15.0f * scale, 15.0f * scale);
+            renderer.DrawCube(iconPos3D, cubeScale, fallbackColor, rotation);
         }
         
         // Draw save name (2D text overlay)
         float screenX = 200.0f;
-        float screenY = 224.0f - icon.position.y * 0.8f;
+        float screenY = 224.0f - position.y * 0.8f;
         
         // Selection highlight
         if (icon.selected) {
@@ -339,5 +344,6 @@ void BrowserScene::Render(Renderer& renderer) {
 
     // Draw navigation hints at bottom
     Color hintColor(0.5f, 0.5f, 0.6f, 0.7f * sceneAlpha);
-    renderer.DrawText("UP/DOWN: Select   ENTER: Options   BACKSPACE: Back", 120.0f, 420.0f, hintColor, 0.8f);
+    renderer.SetTextMesh(hintText, "UP/DOWN: Select   ENTER: Options   BACKSPACE: Back", 120.0f, 420.0f, hintColor, 0.8f);
+    renderer.DrawTextMesh(hintText);
 }
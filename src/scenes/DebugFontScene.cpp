@@ -26,12 +26,14 @@ void DebugFontScene::OnEnter() {
 }
 
 void DebugFontScene::OnExit() {
-    for (auto& t : debugTextures) {
-        if (t.valid && t.id != 0) {
-            glDeleteTextures(1, &t.id);
+    // Through the renderer: it owns the GL context (possibly on another thread)
+    if (ownerRenderer) {
+        for (auto& t : debugTextures) {
+            ownerRenderer->DeleteTexture(t);
         }
     }
     debugTextures.clear();
+    ownerRenderer = nullptr;
 }
 
 void DebugFontScene::HandleInput(const SDL_Event& event) {
@@ -74,6 +76,8 @@ void DebugFontScene::Update(double dt) {
 }
 
 void DebugFontScene::Render(Renderer& renderer) {
+    ownerRenderer = &renderer;
+
     // Lazy Texture Loading (Carrega apenas ao renderizar a primeira vez)
     if (!texturesLoaded) {
         static FontLoader localLoader;
@@ -21,5 +21,6 @@ private:
     bool texturesLoaded = false;
 
     std::vector<Texture> debugTextures; 
+    Renderer* ownerRenderer = nullptr;   // Set in Render, used to free textures on exit
     void DrawBank(Renderer& renderer, int bankIndex, float yOffset, float alpha);
 };
\ No newline at end of file
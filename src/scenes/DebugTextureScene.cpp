@@ -32,6 +32,10 @@ void DebugTextureScene::HandleInput(const SDL_Event& event) {
         else if (event.key.keysym.sym == SDLK_RIGHT) zoom += 0.5f; 
         else if (event.key.keysym.sym == SDLK_LEFT) { zoom -= 0.5f; if(zoom<0.5f) zoom=0.5f; }
         else if (event.key.keysym.sym == SDLK_SPACE) showAlphaChecker = !showAlphaChecker;
+        else if (event.key.keysym.sym == SDLK_g) {
+            gpuDecode = !gpuDecode;
+            loadedName = "";    // Recarrega pelo outro caminho
+        }
         else if (event.key.keysym.sym == SDLK_ESCAPE || event.key.keysym.sym == SDLK_BACKSPACE) {
             requestedNextState = (int)State::Menu;
         }
@@ -73,11 +77,21 @@ void DebugTextureScene::Render(Renderer& renderer) {
         std::string target = textureFiles[selectedIndex];
         if (target != loadedName) {
             if (currentTexture.valid) renderer.DeleteTexture(currentTexture);
+            if (gsTexture.valid) renderer.DeleteGsTexture(gsTexture);
             
             // CORREÇÃO AQUI: Cast explicito float na Color
             renderer.DrawText("Loading...", centerX - 30.0f, centerY, Color(1.0f,1.0f,0.0f, 1.0f), 1.0f);
             
-            if (loader.Load(target, texInfo)) {
+            GsRawData raw;
+            if (gpuDecode && loader.LoadRaw(target, raw)) {
+                gsTexture = renderer.CreateGsTexture(raw);
+                texInfo.width = raw.width;
+                texInfo.height = raw.height;
+                texInfo.format = (raw.psm == GS_PSM_4) ? TexFormat::Indexed4 :
+                                 (raw.psm == GS_PSM_8) ? TexFormat::Indexed8 :
+                                 (raw.psm == GS_PSM_16) ? TexFormat::RGBA16 : TexFormat::RGBA32;
+                loadedName = target;
+            } else if (!gpuDecode && loader.Load(target, texInfo)) {
                 currentTexture = renderer.CreateTexture(texInfo.pixels.data(), texInfo.width, texInfo.height, 4);
                 loadedName = target;
             } else {
@@ -88,15 +102,16 @@ void DebugTextureScene::Render(Renderer& renderer) {
     }
 
     // DRAW TEXTURE
-    if (currentTexture.valid) {
-        float drawW = (float)currentTexture.width * zoom;
-        float drawH = (float)currentTexture.height * zoom;
+    if (currentTexture.valid || gsTexture.valid) {
+        float drawW = (float)texInfo.width * zoom;
+        float drawH = (float)texInfo.height * zoom;
         float dx = centerX - drawW / 2.0f;
         float dy = centerY - drawH / 2.0f;
 
         if (showAlphaChecker) DrawCheckerboard(renderer, dx, dy, drawW, drawH);
         
-        renderer.DrawSprite(currentTexture, dx, dy, drawW, drawH);
+        if (gsTexture.valid) renderer.DrawSprite(gsTexture, dx, dy, drawW, drawH);
+        else renderer.DrawSprite(currentTexture, dx, dy, drawW, drawH);
         
         // Info Header
         char buf[128];
@@ -104,7 +119,8 @@ void DebugTextureScene::Render(Renderer& renderer) {
                           (texInfo.format==TexFormat::Indexed8)?"8bpp":
                           (texInfo.format==TexFormat::RGBA16)?"RGBA16":"RGBA32";
         
-        snprintf(buf, 128, "%s [%dx%d] %s", loadedName.c_str(), currentTexture.width, currentTexture.height, fmt);
+        snprintf(buf, 128, "%s [%dx%d] %s (%s)", loadedName.c_str(), texInfo.width, texInfo.height, fmt,
+                 gsTexture.valid ? "GPU" : "CPU");
         renderer.DrawText(buf, previewX, 20.0f, Color(1.0f, 1.0f, 1.0f, 1.0f), 1.0f);
         
         snprintf(buf, 128, "Zoom: %.1fx", zoom);
@@ -144,7 +160,7 @@ void DebugTextureScene::Render(Renderer& renderer) {
 
     // Footer
     renderer.DrawRect(200, 420, 440, 28, Color(0.0f,0.0f,0.0f,0.5f));
-    renderer.DrawText("Nav: Arrows | Space: Alpha | ESC: Menu", 220.0f, 426.0f, Color(0.8f, 0.8f, 0.8f, 1.0f), 0.7f);
+    renderer.DrawText("Nav: Arrows | Space: Alpha | G: GPU | ESC: Menu", 220.0f, 426.0f, Color(0.8f, 0.8f, 0.8f, 1.0f), 0.7f);
 }
 
 void DebugTextureScene::DrawCheckerboard(Renderer& r, float x, float y, float w, float h) {
@@ -22,6 +22,10 @@ private:
     Texture currentTexture;
     std::string loadedName;
     TexData texInfo;
+
+    // G: decodifica na GPU (payload GS cru + gs_sprite.frag)
+    GsTexture gsTexture;
+    bool gpuDecode = false;
     
     // View state
     float zoom = 1.0f;
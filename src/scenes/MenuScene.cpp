@@ -19,8 +19,10 @@
 struct MenuItem {
     std::string name;
     Vec3 position;
+    Vec3 prevPosition;      // At the previous tick (render interpolation)
     Vec3 targetPosition;
     float scale;
+    float prevScale;
     float targetScale;
     bool selected;
     Color color;
@@ -36,6 +38,7 @@ struct BackgroundOrb {
 
 struct FloatingParticle {
     Vec3 position;
+    Vec3 prevPosition;
     Vec3 velocity;
     float alpha;
     float size;
@@ -47,10 +50,11 @@ struct FloatingParticle {
 static std::vector<MenuItem> menuItems;
 static int selectedIndex = 0;
 static BackgroundOrb orb;
+static Vec3 prevOrbPosition;
 static std::vector<FloatingParticle> particles;
+static std::vector<InstanceData> particleInstances;
 static float sceneAlpha = 0.0f;
-static ICOBModel orbMesh;
-static bool orbMeshLoaded = false;
+static TextMesh hintText;
 
 // Menu item definitions
 static const char* MENU_ITEMS[] = {
@@ -75,6 +79,8 @@ void MenuScene::OnEnter() {
         item.position = Vec3(-200.0f, 60.0f - i * 50.0f, 0.0f); // Start offset
         item.scale = 1.0f;
         item.targetScale = 1.0f;
+        item.prevPosition = item.position;
+        item.prevScale = item.scale;
         item.selected = (i == 0);
         item.color = Color(0.7f, 0.7f, 0.8f, 1.0f);
         menuItems.push_back(item);
@@ -86,6 +92,7 @@ void MenuScene::OnEnter() {
     orb.glowIntensity = 1.0f;
     orb.pulsePhase = 0.0f;
     orb.baseColor = Color(0.2f, 0.4f, 0.9f, 1.0f);
+    prevOrbPosition = orb.position;
 
     // Initialize floating particles
     particles.clear();
@@ -106,20 +113,10 @@ void MenuScene::OnEnter() {
         p.size = ((float)rand() / RAND_MAX) * 3.0f + 1.0f;
         p.lifetime = ((float)rand() / RAND_MAX) * 10.0f + 5.0f;
         p.age = ((float)rand() / RAND_MAX) * p.lifetime; // Random start phase
+        p.prevPosition = p.position;
         particles.push_back(p);
     }
 
-    // Try to load orb mesh (ICOBYSYS or similar)
-    AssetLoader assetLoader;
-    ICOBModel model;
-    if (assetLoader.LoadICOB("ICOBYSYS", model)) {
-        orbMesh = model;
-        orbMeshLoaded = true;
-        printf("[MenuScene] Orb mesh loaded: %zu vertices\n", orbMesh.vertices.size());
-    } else {
-        orbMeshLoaded = false;
-    }
-
     printf("[MenuScene] Initialized: %zu menu items, %zu particles\n", 
            menuItems.size(), particles.size());
 }
@@ -183,6 +180,9 @@ void MenuScene::Update(double dt) {
     for (size_t i = 0; i < menuItems.size(); i++) {
         auto& item = menuItems[i];
         
+        item.prevPosition = item.position;
+        item.prevScale = item.scale;
+
         // Target scale based on selection
         item.targetScale = item.selected ? 1.3f : 1.0f;
         item.scale = Math::Lerp(item.scale, item.targetScale, (float)dt * 10.0f);
@@ -209,10 +209,12 @@ void MenuScene::Update(double dt) {
     
     // Orb subtly moves based on selection
     float targetY = 60.0f - selectedIndex * 50.0f;
+    prevOrbPosition = orb.position;
     orb.position.y = Math::Lerp(orb.position.y, targetY * 0.3f, (float)dt * 2.0f);
 
     // Update floating particles
     for (auto& p : particles) {
+        p.prevPosition = p.position;
         p.position = p.position + p.velocity * (float)dt;
         p.age += (float)dt;
         
@@ -225,6 +227,7 @@ void MenuScene::Update(double dt) {
                 -180.0f, // Start from bottom
                 -200.0f + ((float)rand() / RAND_MAX) * 100.0f
             );
+            p.prevPosition = p.position;    // Don't interpolate across the respawn
             p.age = 0.0f;
         }
         
@@ -250,43 +253,56 @@ void MenuScene::Update(double dt) {
 }
 
 void MenuScene::Render(Renderer& renderer) {
+    float t = RenderTime();
+
     // Set fog
     renderer.SetFog(0.02f, Vec3(0.05f, 0.05f, 0.1f));
 
-    // Draw floating particles
+    // Draw floating particles (single instanced draw)
+    particleInstances.clear();
     for (const auto& p : particles) {
         if (p.alpha > 0.01f) {
-            Color particleColor(0.4f, 0.5f, 0.8f, p.alpha * sceneAlpha);
-            renderer.DrawSphere(p.position, p.size, particleColor, 4);
+            InstanceData inst;
+            inst.position = Math::Lerp(p.prevPosition, p.position, renderAlpha);
+            inst.scale = Vec3(p.size);
+            inst.color = Color(0.4f, 0.5f, 0.8f, p.alpha * sceneAlpha);
+            particleInstances.push_back(inst);
         }
     }
+    renderer.DrawSpheresInstanced(particleInstances.data(), particleInstances.size(), 4);
 
     // Draw central orb
     Color orbColor = orb.baseColor;
     orbColor.a = orb.glowIntensity * sceneAlpha;
     
-    if (orbMeshLoaded) {
-        Vec3 orbRot(time * 0.2f, time * 0.3f, 0.0f);
-        renderer.DrawMesh(orbMesh, orb.position, Vec3(orb.radius * 0.5f), orbColor, orbRot);
+    Vec3 orbPos = Math::Lerp(prevOrbPosition, orb.position, renderAlpha);
+    GpuMesh orbMesh = renderer.GetCachedMesh("ICOBYSYS");
+    if (orbMesh.valid) {
+        Vec3 orbRot(t * 0.2f, t * 0.3f, 0.0f);
+        renderer.DrawMesh(orbMesh, orbPos, Vec3(orb.radius * 0.5f), orbColor, orbRot);
     } else {
-        renderer.DrawSphere(orb.position, orb.radius, orbColor, 16);
+        renderer.DrawSphere(orbPos, orb.radius, orbColor, 16);
     }
     
-    // Orb glow
-    renderer.SetBlendMode(true);
-    Color glowColor(0.3f, 0.5f, 0.9f, orb.glowIntensity * 0.3f * sceneAlpha);
-    renderer.DrawSphere(orb.position, orb.radius * 1.5f, glowColor, 12);
-    renderer.SetBlendMode(false);
+    // Orb glow (bloom does it as a post effect when enabled)
+    if (!renderer.IsBloomActive()) {
+        renderer.SetBlendMode(true);
+        Color glowColor(0.3f, 0.5f, 0.9f, orb.glowIntensity * 0.3f * sceneAlpha);
+        renderer.DrawSphere(orbPos, orb.radius * 1.5f, glowColor, 12);
+        renderer.SetBlendMode(false);
+    }
 
     // Draw menu items (placeholder rectangles until text rendering is ready)
     for (size_t i = 0; i < menuItems.size(); i++) {
         const auto& item = menuItems[i];
         
         // Calculate screen position (approximate)
-        float screenX = 50.0f + item.position.x * 0.3f;
-        float screenY = 200.0f - item.position.y * 1.5f;
-        float width = 200.0f * item.scale;
-        float height = 24.0f * item.scale;
+        Vec3 itemPos = Math::Lerp(item.prevPosition, item.position, renderAlpha);
+        float itemScale = Math::Lerp(item.prevScale, item.scale, renderAlpha);
+        float screenX = 50.0f + itemPos.x * 0.3f;
+        float screenY = 200.0f - itemPos.y * 1.5f;
+        float width = 200.0f * itemScale;
+        float height = 24.0f * itemScale;
         
         // Selection highlight background
         if (item.selected) {
@@ -297,11 +313,11 @@ void MenuScene::Render(Renderer& renderer) {
         // Text placeholder
         Color textColor = item.color;
         textColor.a *= sceneAlpha;
-        renderer.DrawText(item.name.c_str(), screenX, screenY, textColor, item.scale);
+        renderer.DrawText(item.name.c_str(), screenX, screenY, textColor, itemScale);
         
         // Selection indicator (arrow or cursor)
         if (item.selected) {
-            float cursorPulse = 0.7f + 0.3f * sinf(time * 5.0f);
+            float cursorPulse = 0.7f + 0.3f * sinf(t * 5.0f);
             Color cursorColor(1.0f, 1.0f, 1.0f, cursorPulse * sceneAlpha);
             renderer.DrawRect(screenX - 20.0f, screenY + 4.0f, 10.0f, 10.0f, cursorColor);
         }
@@ -309,5 +325,6 @@ void MenuScene::Render(Renderer& renderer) {
 
     // Draw navigation hints at bottom
     Color hintColor(0.5f, 0.5f, 0.6f, 0.7f * sceneAlpha);
-    renderer.DrawText("UP/DOWN: Select   ENTER: Confirm", 180.0f, 420.0f, hintColor, 0.8f);
+    renderer.SetTextMesh(hintText, "UP/DOWN: Select   ENTER: Confirm", 180.0f, 420.0f, hintColor, 0.8f);
+    renderer.DrawTextMesh(hintText);
 }
@@ -79,15 +79,13 @@ void SCELogoScene::Render(Renderer& renderer) {
     // PS2 resolution: 640x448
     const char* line1 = "Sony Computer Entertainment";
     
-    // Calculate text width for centering
+    // Centered across the screen (layout is measured once and cached)
     float scale = 1.0f;
-    float textWidth = renderer.GetTextWidth(line1, scale);
-    float x = (640.0f - textWidth) / 2.0f;
     float y = 200.0f;
     
     // Golden/amber color like original PS2
     Color textColor(0.9f, 0.75f, 0.3f, textAlpha * sceneAlpha);
-    renderer.DrawText(line1, x, y, textColor, scale);
+    renderer.DrawTextBox(line1, 0.0f, y, 640.0f, TextAlign::Center, textColor, scale);
     
     // Optional: Draw a subtle horizontal line under the text
     if (textAlpha > 0.5f) {
@@ -101,7 +99,6 @@ void SCELogoScene::Render(Renderer& renderer) {
     // Copyright text at bottom
     const char* copyright = "(C) 2000 Sony Computer Entertainment Inc.";
     float copyScale = 0.6f;
-    float copyWidth = renderer.GetTextWidth(copyright, copyScale);
     Color copyColor(0.5f, 0.5f, 0.5f, textAlpha * sceneAlpha * 0.7f);
-    renderer.DrawText(copyright, (640.0f - copyWidth) / 2.0f, 400.0f, copyColor, copyScale);
+    renderer.DrawTextBox(copyright, 0.0f, 400.0f, 640.0f, TextAlign::Center, copyColor, copyScale);
 }
@@ -19,14 +19,21 @@ public:
     // Input
     virtual void HandleInput(const SDL_Event& event) {}
 
-    // Update (fixed timestep - 60 Hz)
+    // Update (fixed timestep - 60 Hz by default, 59.94 / 50 Hz for NTSC / PAL)
     virtual void Update(double dt) = 0;
 
-    // Render
+    // Render (may run more or less often than Update, see renderAlpha)
     virtual void Render(Renderer& renderer) = 0;
 
 protected:
     float time = 0.0f; // Scene internal time (in seconds)
+    float prevTime = 0.0f; // time before the last Update
+
+    // Display position between the previous (0) and the current (1) tick.
+    // Render should interpolate animated state with it instead of drawing
+    // the last tick as is, so motion stays smooth at any refresh rate
+    float renderAlpha = 1.0f;
+    float RenderTime() const { return prevTime + (time - prevTime) * renderAlpha; }
     
     // Request state transition (checked by MainLoopController)
     // Set to valid state to request transition, or -1 for none